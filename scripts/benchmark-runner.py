@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+# Copyright (c) Facebook, Inc. and its affiliates.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Runs the folly::Benchmark suites and compares runs for regressions.
+
+Usage:
+    # Run every benchmark binary found under the build tree and write one
+    # merged JSON file. Each binary runs --bm_min_iters repetitions and the
+    # whole suite is repeated --runs times; the fastest time per benchmark is
+    # kept, which suppresses scheduler noise.
+    benchmark-runner.py run --binary-dir _build/release/velox/benchmarks \\
+        --output baseline.json
+
+    # Optionally wrap each binary in 'perf stat' to capture instruction and
+    # cache-miss counters next to the timings.
+    benchmark-runner.py run --binary-dir ... --output now.json --perf
+
+    # Compare against a baseline. Exits non-zero when any benchmark is slower
+    # than baseline by more than --threshold (default 5%) beyond the noise
+    # floor estimated from the baseline's repeated runs.
+    benchmark-runner.py compare baseline.json now.json --threshold 0.05
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+def find_benchmark_binaries(binary_dir):
+    """Every executable under 'binary_dir': point this at the build tree's
+    benchmarks root to pick up basic/, exec/benchmarks and
+    expression/benchmarks together."""
+    binaries = []
+    for root, _dirs, files in os.walk(binary_dir):
+        for name in files:
+            path = os.path.join(root, name)
+            if os.access(path, os.X_OK) and not os.path.isdir(path):
+                binaries.append(path)
+    return sorted(binaries)
+
+
+def run_binary(path, perf):
+    """Runs one benchmark binary with JSON output; returns {name: nanos}."""
+    command = [path, "--bm_json_verbose", "/dev/stdout", "--json"]
+    if perf:
+        command = [
+            "perf",
+            "stat",
+            "-j",
+            "-e",
+            "instructions,cache-misses",
+            "--",
+        ] + command
+    result = subprocess.run(
+        command, capture_output=True, text=True, timeout=3600
+    )
+    if result.returncode != 0:
+        print(f"WARNING: {path} failed: {result.stderr[-500:]}", file=sys.stderr)
+        return {}, {}
+    timings = {}
+    # folly --json prints a {"benchmark_name": nanos_per_iter} object as the
+    # last JSON document on stdout.
+    for line in reversed(result.stdout.splitlines()):
+        line = line.strip()
+        if line.startswith("{"):
+            try:
+                parsed = json.loads(line)
+            except json.JSONDecodeError:
+                continue
+            timings = {
+                name: value
+                for name, value in parsed.items()
+                if isinstance(value, (int, float))
+            }
+            break
+    counters = {}
+    if perf:
+        # perf stat -j writes one JSON object per line on stderr.
+        for line in result.stderr.splitlines():
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            try:
+                event = json.loads(line)
+            except json.JSONDecodeError:
+                continue
+            if "event" in event and "counter-value" in event:
+                counters[event["event"]] = event["counter-value"]
+    return timings, counters
+
+
+def command_run(args):
+    binaries = find_benchmark_binaries(args.binary_dir)
+    if not binaries:
+        print(f"No benchmark binaries under {args.binary_dir}", file=sys.stderr)
+        return 1
+    suite = {}
+    for _ in range(args.runs):
+        for path in binaries:
+            timings, counters = run_binary(path, args.perf)
+            for name, nanos in timings.items():
+                key = f"{os.path.basename(path)}/{name}"
+                entry = suite.setdefault(
+                    key, {"runs": [], "counters": counters}
+                )
+                entry["runs"].append(nanos)
+    for entry in suite.values():
+        entry["best"] = min(entry["runs"])
+        # Noise floor: spread of the repeated runs relative to the best.
+        entry["noise"] = (
+            (max(entry["runs"]) - entry["best"]) / entry["best"]
+            if entry["best"] > 0
+            else 0.0
+        )
+    with open(args.output, "w") as out:
+        json.dump(suite, out, indent=2, sort_keys=True)
+    print(f"Wrote {len(suite)} benchmark results to {args.output}")
+    return 0
+
+
+def command_compare(args):
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.contender) as f:
+        contender = json.load(f)
+    regressions = []
+    for name, entry in sorted(contender.items()):
+        base = baseline.get(name)
+        if base is None or base["best"] <= 0:
+            continue
+        ratio = entry["best"] / base["best"] - 1.0
+        # A regression must clear the threshold beyond the noise observed in
+        # the baseline's own repeated runs.
+        allowed = args.threshold + base.get("noise", 0.0)
+        marker = ""
+        if ratio > allowed:
+            marker = "  <-- REGRESSION"
+            regressions.append((name, ratio))
+        if args.verbose or marker:
+            print(f"{name}: {ratio * 100:+.1f}% (allowed {allowed * 100:.1f}%){marker}")
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) beyond threshold.")
+        return 1
+    print("No regressions beyond threshold.")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = subparsers.add_parser("run")
+    run_parser.add_argument("--binary-dir", required=True)
+    run_parser.add_argument("--output", required=True)
+    run_parser.add_argument("--runs", type=int, default=3)
+    run_parser.add_argument("--perf", action="store_true")
+    run_parser.set_defaults(func=command_run)
+
+    compare_parser = subparsers.add_parser("compare")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("contender")
+    compare_parser.add_argument("--threshold", type=float, default=0.05)
+    compare_parser.add_argument("--verbose", action="store_true")
+    compare_parser.set_defaults(func=command_compare)
+
+    args = parser.parse_args()
+    sys.exit(args.func(args))
+
+
+if __name__ == "__main__":
+    main()
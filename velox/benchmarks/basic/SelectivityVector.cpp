@@ -39,7 +39,8 @@ class SelectivityVectorBenchmark
         rows99PerCent_(vectorSize),
         rows50PerCent_(vectorSize),
         rows10PerCent_(vectorSize),
-        rows1PerCent_(vectorSize) {
+        rows1PerCent_(vectorSize),
+        rowsFirstHalf_(vectorSize) {
     VectorFuzzer::Options opts;
     opts.vectorSize = vectorSize_;
     opts.nullRatio = 0;
@@ -68,11 +69,15 @@ class SelectivityVectorBenchmark
       }
     }
 
+    // A dense-contiguous selection: the first half of the rows.
+    rowsFirstHalf_.setValidRange(vectorSize_ / 2, vectorSize_, false);
+
     rowsAll_.updateBounds();
     rows99PerCent_.updateBounds();
     rows50PerCent_.updateBounds();
     rows10PerCent_.updateBounds();
     rows1PerCent_.updateBounds();
+    rowsFirstHalf_.updateBounds();
   }
 
   size_t runBaseline() {
@@ -106,6 +111,30 @@ class SelectivityVectorBenchmark
     return run(rows99PerCent_);
   }
 
+  size_t runSelectivityFirstHalf() {
+    return run(rowsFirstHalf_);
+  }
+
+  size_t runRanges(const SelectivityVector& rows) {
+    const int64_t* flatBuffer = flatVector_->values()->as<int64_t>();
+    size_t sum = 0;
+    rows.applyToSelectedRanges([&](auto begin, auto end) {
+      for (auto row = begin; row < end; ++row) {
+        sum += flatBuffer[row];
+      }
+    });
+    folly::doNotOptimizeAway(sum);
+    return vectorSize_;
+  }
+
+  size_t runRangesFirstHalf() {
+    return runRanges(rowsFirstHalf_);
+  }
+
+  size_t runRanges50PerCent() {
+    return runRanges(rows50PerCent_);
+  }
+
  private:
   size_t run(const SelectivityVector& rows) {
     const int64_t* flatBuffer = flatVector_->values()->as<int64_t>();
@@ -124,6 +153,7 @@ class SelectivityVectorBenchmark
   SelectivityVector rows50PerCent_;
   SelectivityVector rows10PerCent_;
   SelectivityVector rows1PerCent_;
+  SelectivityVector rowsFirstHalf_;
 };
 
 std::unique_ptr<SelectivityVectorBenchmark> benchmark;
@@ -152,6 +182,18 @@ BENCHMARK_MULTI(sumSelectivity1PerCent) {
   return benchmark->runSelectivity1PerCent();
 }
 
+BENCHMARK_MULTI(sumSelectivityFirstHalf) {
+  return benchmark->runSelectivityFirstHalf();
+}
+
+BENCHMARK_MULTI(sumRangesFirstHalf) {
+  return benchmark->runRangesFirstHalf();
+}
+
+BENCHMARK_MULTI(sumRanges50PerCent) {
+  return benchmark->runRanges50PerCent();
+}
+
 } // namespace
 
 int main(int argc, char* argv[]) {
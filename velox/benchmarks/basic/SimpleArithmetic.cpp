@@ -17,6 +17,7 @@
 #include <folly/Benchmark.h>
 #include <gflags/gflags.h>
 
+#include "velox/expression/FusedFunctionAdapter.h"
 #include "velox/functions/Registerer.h"
 #include "velox/functions/lib/benchmarks/FunctionBenchmarkBase.h"
 #include "velox/functions/prestosql/ArithmeticImpl.h"
@@ -61,6 +62,21 @@ struct MultiplyNullOutputFunction {
   }
 };
 
+// Scalar kernels for the fused multiply-plus chain.
+template <typename T>
+struct MultiplyKernel {
+  FOLLY_ALWAYS_INLINE static T apply(T value, T param) {
+    return functions::multiply(value, param);
+  }
+};
+
+template <typename T>
+struct PlusKernel {
+  FOLLY_ALWAYS_INLINE static T apply(T value, T param) {
+    return functions::plus(value, param);
+  }
+};
+
 // Checked vs. Unchecked Arithmetic.
 template <typename T>
 struct PlusFunction {
@@ -95,6 +111,11 @@ class SimpleArithmeticBenchmark
     registerFunction<CheckedPlusFunction, int64_t, int64_t, int64_t>(
         {"checked_plus"});
 
+    // Simple function chain vs. the same chain fused into one loop.
+    registerFunction<PlusFunction, double, double, double>({"plus_double"});
+    registerFusedKernel<double, MultiplyKernel<double>, PlusKernel<double>>(
+        "fused_multiply_plus");
+
     // Set input schema.
     inputType_ = ROW({
         {"a", DOUBLE()},
@@ -218,6 +239,16 @@ BENCHMARK_MULTI(plusCheckedSmall, n) {
   return benchmark->runSmall("checked_plus(c, d)", n);
 }
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_MULTI(multiplyPlusChainSmall, n) {
+  return benchmark->runSmall("plus_double(multiply(a, 2.0), 1.0)", n);
+}
+
+BENCHMARK_MULTI(multiplyPlusFusedSmall, n) {
+  return benchmark->runSmall("fused_multiply_plus(a, 2.0, 1.0)", n);
+}
+
 BENCHMARK_DRAW_LINE();
 BENCHMARK_DRAW_LINE();
 
@@ -272,6 +303,16 @@ BENCHMARK_MULTI(plusCheckedMedium, n) {
   return benchmark->runMedium("checked_plus(c, d)", n);
 }
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_MULTI(multiplyPlusChainMedium, n) {
+  return benchmark->runMedium("plus_double(multiply(a, 2.0), 1.0)", n);
+}
+
+BENCHMARK_MULTI(multiplyPlusFusedMedium, n) {
+  return benchmark->runMedium("fused_multiply_plus(a, 2.0, 1.0)", n);
+}
+
 BENCHMARK_DRAW_LINE();
 BENCHMARK_DRAW_LINE();
 
@@ -326,6 +367,16 @@ BENCHMARK_MULTI(plusCheckedLarge, n) {
   return benchmark->runLarge("checked_plus(c, d)", n);
 }
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_MULTI(multiplyPlusChainLarge, n) {
+  return benchmark->runLarge("plus_double(multiply(a, 2.0), 1.0)", n);
+}
+
+BENCHMARK_MULTI(multiplyPlusFusedLarge, n) {
+  return benchmark->runLarge("fused_multiply_plus(a, 2.0, 1.0)", n);
+}
+
 } // namespace
 
 int main(int argc, char* argv[]) {
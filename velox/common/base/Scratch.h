@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox {
+
+/// A pool of reusable scratch buffers shared by the operators of one
+/// driver. Temporaries leased through ScratchPtr at batch scope return
+/// here on destruction, so the same region serves e.g. the sort's key
+/// prefixes and the spiller's swap space in turn instead of each
+/// holding a private peak-sized buffer. Memory is uninitialized and
+/// unpadded. Not thread safe; use one Scratch per driver.
+class Scratch {
+ public:
+  /// Total bytes kept across pooled buffers before the pool is
+  /// dropped and starts over.
+  static constexpr int64_t kMaxRetainedBytes = 32 << 20;
+
+  Scratch() = default;
+  Scratch(const Scratch&) = delete;
+  void operator=(const Scratch&) = delete;
+
+  ~Scratch() {
+    clear();
+  }
+
+  /// Returns a buffer of at least 'size' bytes and its actual
+  /// capacity, reusing the smallest pooled buffer that fits, else
+  /// freshly allocated. Return with release().
+  std::pair<void*, int64_t> get(int64_t size) {
+    int32_t best = -1;
+    for (int32_t i = 0; i < items_.size(); ++i) {
+      if (items_[i].size >= size &&
+          (best < 0 || items_[i].size < items_[best].size)) {
+        best = i;
+      }
+    }
+    if (best >= 0) {
+      auto item = items_[best];
+      items_[best] = items_.back();
+      items_.pop_back();
+      retainedBytes_ -= item.size;
+      return {item.ptr, item.size};
+    }
+    auto* ptr = ::malloc(size);
+    VELOX_CHECK_NOT_NULL(ptr);
+    return {ptr, size};
+  }
+
+  /// Returns a buffer obtained from get() to the pool for reuse.
+  void release(void* ptr, int64_t size) {
+    items_.push_back({ptr, size});
+    retainedBytes_ += size;
+    if (retainedBytes_ > kMaxRetainedBytes) {
+      clear();
+    }
+  }
+
+  void clear() {
+    for (auto& item : items_) {
+      ::free(item.ptr);
+    }
+    items_.clear();
+    retainedBytes_ = 0;
+  }
+
+  int64_t retainedBytes() const {
+    return retainedBytes_;
+  }
+
+ private:
+  struct Item {
+    void* ptr;
+    int64_t size;
+  };
+
+  std::vector<Item> items_;
+  int64_t retainedBytes_{0};
+};
+
+/// RAII lease of 'size' elements of T from 'scratch'. The memory is
+/// uninitialized and valid until destruction, which returns it to the
+/// pool.
+template <typename T>
+class ScratchPtr {
+ public:
+  ScratchPtr(Scratch& scratch, int64_t size) : scratch_(scratch) {
+    std::tie(ptr_, capacity_) =
+        scratch.get(size * static_cast<int64_t>(sizeof(T)));
+  }
+  ScratchPtr(const ScratchPtr&) = delete;
+  void operator=(const ScratchPtr&) = delete;
+
+  ~ScratchPtr() {
+    scratch_.release(ptr_, capacity_);
+  }
+
+  T* get() {
+    return reinterpret_cast<T*>(ptr_);
+  }
+
+  T& operator[](int64_t index) {
+    return get()[index];
+  }
+
+ private:
+  Scratch& scratch_;
+  void* ptr_{nullptr};
+  int64_t capacity_{0};
+};
+
+} // namespace facebook::velox
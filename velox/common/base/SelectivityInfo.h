@@ -47,6 +47,12 @@ class SelectivityInfo {
     return numOut_;
   }
 
+  /// Raw cycles spent reading and filtering, in
+  /// folly::hardware_timestamp units.
+  uint64_t timeClocks() const {
+    return timeClocks_;
+  }
+
  private:
   uint64_t numIn_ = 0;
   uint64_t numOut_ = 0;
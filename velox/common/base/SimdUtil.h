@@ -360,6 +360,141 @@ xsimd::batch<T, A> setAll(T value, const A& = {}) {
   }
 }
 
+namespace detail {
+// Applies 'batchOp' to the whole 64-bit words of bit range [begin, end)
+// a SIMD batch of words at a time with a scalar word tail, and 'bitsOp'
+// to the partial edge words. Bits outside the range are unchanged.
+template <typename A, typename BatchOp, typename WordOp, typename BitsOp>
+inline void forBatchWords(
+    int32_t begin,
+    int32_t end,
+    BatchOp batchOp,
+    WordOp wordOp,
+    BitsOp bitsOp) {
+  constexpr int32_t kBatchWords = xsimd::batch<uint64_t, A>::size;
+  const int32_t firstWord = bits::roundUp(begin, 64) / 64;
+  const int32_t lastWord = end / 64;
+  if (firstWord >= lastWord) {
+    bitsOp(begin, end);
+    return;
+  }
+  if (begin < firstWord * 64) {
+    bitsOp(begin, firstWord * 64);
+  }
+  int32_t i = firstWord;
+  for (; i + kBatchWords <= lastWord; i += kBatchWords) {
+    batchOp(i);
+  }
+  for (; i < lastWord; ++i) {
+    wordOp(i);
+  }
+  if (lastWord * 64 < end) {
+    bitsOp(lastWord * 64, end);
+  }
+}
+} // namespace detail
+
+// In-place AND of bits [begin, end) of 'target' with the corresponding
+// bits of 'right', processing whole words a SIMD batch at a time. Bits
+// of 'target' outside the range are unchanged.
+template <typename A = xsimd::default_arch>
+inline void andBits(
+    uint64_t* target,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end,
+    const A& = {}) {
+  detail::forBatchWords<A>(
+      begin,
+      end,
+      [&](int32_t i) {
+        (xsimd::batch<uint64_t, A>::load_unaligned(target + i) &
+         xsimd::batch<uint64_t, A>::load_unaligned(right + i))
+            .store_unaligned(target + i);
+      },
+      [&](int32_t i) { target[i] &= right[i]; },
+      [&](int32_t from, int32_t to) {
+        bits::andBits(target, right, from, to);
+      });
+}
+
+// In-place AND of bits [begin, end) of 'target' with the negation of
+// the corresponding bits of 'right', SIMD batch at a time.
+template <typename A = xsimd::default_arch>
+inline void andWithNegatedBits(
+    uint64_t* target,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end,
+    const A& = {}) {
+  detail::forBatchWords<A>(
+      begin,
+      end,
+      [&](int32_t i) {
+        (xsimd::batch<uint64_t, A>::load_unaligned(target + i) &
+         ~xsimd::batch<uint64_t, A>::load_unaligned(right + i))
+            .store_unaligned(target + i);
+      },
+      [&](int32_t i) { target[i] &= ~right[i]; },
+      [&](int32_t from, int32_t to) {
+        bits::andWithNegatedBits(target, right, from, to);
+      });
+}
+
+// In-place OR of bits [begin, end) of 'target' with the corresponding
+// bits of 'right', SIMD batch at a time.
+template <typename A = xsimd::default_arch>
+inline void orBits(
+    uint64_t* target,
+    const uint64_t* right,
+    int32_t begin,
+    int32_t end,
+    const A& = {}) {
+  detail::forBatchWords<A>(
+      begin,
+      end,
+      [&](int32_t i) {
+        (xsimd::batch<uint64_t, A>::load_unaligned(target + i) |
+         xsimd::batch<uint64_t, A>::load_unaligned(right + i))
+            .store_unaligned(target + i);
+      },
+      [&](int32_t i) { target[i] |= right[i]; },
+      [&](int32_t from, int32_t to) { bits::orBits(target, right, from, to); });
+}
+
+// Returns the number of set bits in [begin, end) of 'bits'. Whole words
+// are counted in an unrolled loop with one accumulator per lane so the
+// compiler can use vector popcount instructions where available.
+template <typename A = xsimd::default_arch>
+inline int32_t
+countBits(const uint64_t* bits, int32_t begin, int32_t end, const A& = {}) {
+  const int32_t firstWord = velox::bits::roundUp(begin, 64) / 64;
+  const int32_t lastWord = end / 64;
+  if (firstWord >= lastWord) {
+    return velox::bits::countBits(bits, begin, end);
+  }
+  int32_t count = 0;
+  if (begin < firstWord * 64) {
+    count += velox::bits::countBits(bits, begin, firstWord * 64);
+  }
+  int64_t counts[4] = {0, 0, 0, 0};
+  int32_t i = firstWord;
+  for (; i + 4 <= lastWord; i += 4) {
+    counts[0] += __builtin_popcountll(bits[i]);
+    counts[1] += __builtin_popcountll(bits[i + 1]);
+    counts[2] += __builtin_popcountll(bits[i + 2]);
+    counts[3] += __builtin_popcountll(bits[i + 3]);
+  }
+  count += counts[0] + counts[1] + counts[2] + counts[3];
+  for (; i < lastWord; ++i) {
+    count += __builtin_popcountll(bits[i]);
+  }
+  if (lastWord * 64 < end) {
+    count += velox::bits::countBits(bits, lastWord * 64, end);
+  }
+  return count;
+}
+
 // Adds 'bytes' bytes to an address of arbitrary type.
 template <typename T>
 inline T* addBytes(T* pointer, int32_t bytes) {
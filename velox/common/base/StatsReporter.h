@@ -17,6 +17,9 @@
 #pragma once
 
 #include <folly/Singleton.h>
+#include <folly/Synchronized.h>
+#include <folly/ThreadLocal.h>
+#include <folly/container/F14Map.h>
 #include <memory>
 
 /// StatsReporter designed to assist in reporting various stats of the
@@ -90,6 +93,102 @@ class DummyStatsReporter : public BaseStatsReporter {
       const override {}
 };
 
+/// A BaseStatsReporter backend that aggregates counters in per-thread
+/// cells so that hot-path reporting never contends across threads: a
+/// report takes this thread's uncontended lock and bumps a counter.
+/// Exporters pull with snapshot(), which folds live threads' cells and
+/// the counts of exited threads into one monotonic view, in the style
+/// of a Prometheus collect. Register it as the process reporter with
+/// the folly::Singleton pattern above.
+class ThreadLocalStatsReporter : public BaseStatsReporter {
+ public:
+  struct Counter {
+    int64_t sum{0};
+    int64_t count{0};
+  };
+
+  using CounterMap = folly::F14FastMap<std::string, Counter>;
+
+  void addStatExportType(const char* key, StatType statType) const override {
+    types_.wlock()->emplace(key, statType);
+  }
+
+  void addStatExportType(folly::StringPiece key, StatType statType)
+      const override {
+    types_.wlock()->emplace(key.str(), statType);
+  }
+
+  void addStatValue(const std::string& key, size_t value = 1) const override {
+    auto cells = cells_.get()->map.wlock();
+    auto& counter = (*cells)[key];
+    counter.sum += value;
+    ++counter.count;
+  }
+
+  void addStatValue(const char* key, size_t value = 1) const override {
+    addStatValue(std::string(key), value);
+  }
+
+  void addStatValue(folly::StringPiece key, size_t value = 1) const override {
+    addStatValue(key.str(), value);
+  }
+
+  /// Returns the aggregate of every counter over live and exited
+  /// threads. Counters are monotonic; pull-based exporters report the
+  /// sums directly (COUNT/SUM), rates and averages derive from
+  /// sum/count deltas between snapshots using the registered StatType.
+  CounterMap snapshot() const {
+    CounterMap result = *retired_.rlock();
+    for (auto& cell : cells_.accessAllThreads()) {
+      auto cells = cell.map.rlock();
+      for (const auto& [key, counter] : *cells) {
+        auto& merged = result[key];
+        merged.sum += counter.sum;
+        merged.count += counter.count;
+      }
+    }
+    return result;
+  }
+
+  /// Returns the registered type of 'key', COUNT if never registered.
+  StatType statType(const std::string& key) const {
+    auto types = types_.rlock();
+    auto it = types->find(key);
+    return it == types->end() ? StatType::COUNT : it->second;
+  }
+
+ private:
+  // Per-thread counters. The cell's lock is only ever contended by a
+  // concurrent snapshot; on thread exit the counts fold into
+  // 'retired_' so they survive the thread.
+  struct Cell {
+    explicit Cell(const ThreadLocalStatsReporter* reporter)
+        : reporter_(reporter) {}
+
+    ~Cell() {
+      auto cells = map.wlock();
+      auto retired = reporter_->retired_.wlock();
+      for (const auto& [key, counter] : *cells) {
+        auto& merged = (*retired)[key];
+        merged.sum += counter.sum;
+        merged.count += counter.count;
+      }
+    }
+
+    folly::Synchronized<CounterMap> map;
+
+   private:
+    const ThreadLocalStatsReporter* const reporter_;
+  };
+
+  class Tag;
+
+  mutable folly::ThreadLocal<Cell, Tag> cells_{
+      [this]() { return new Cell(this); }};
+  mutable folly::Synchronized<CounterMap> retired_;
+  mutable folly::Synchronized<folly::F14FastMap<std::string, StatType>> types_;
+};
+
 #define REPORT_ADD_STAT_VALUE(k, ...)                                         \
   {                                                                           \
     auto reporter =                                                           \
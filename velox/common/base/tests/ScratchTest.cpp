@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/base/Scratch.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox;
+
+TEST(ScratchTest, reuse) {
+  Scratch scratch;
+  void* first;
+  {
+    ScratchPtr<int64_t> ptr(scratch, 1000);
+    ptr[0] = 1;
+    ptr[999] = 2;
+    first = ptr.get();
+  }
+  EXPECT_GT(scratch.retainedBytes(), 0);
+
+  // A smaller lease reuses the returned buffer.
+  {
+    ScratchPtr<int32_t> ptr(scratch, 100);
+    EXPECT_EQ(first, ptr.get());
+    EXPECT_EQ(0, scratch.retainedBytes());
+  }
+
+  // Concurrent leases get distinct buffers.
+  {
+    ScratchPtr<int64_t> a(scratch, 10);
+    ScratchPtr<int64_t> b(scratch, 10);
+    EXPECT_NE(a.get(), b.get());
+  }
+}
+
+TEST(ScratchTest, trim) {
+  Scratch scratch;
+  {
+    ScratchPtr<char> ptr(scratch, Scratch::kMaxRetainedBytes + 1);
+  }
+  // A single over-limit buffer is not retained.
+  EXPECT_EQ(0, scratch.retainedBytes());
+}
@@ -295,6 +295,47 @@ TEST_F(SimdUtilTest, memory) {
   }
 }
 
+TEST_F(SimdUtilTest, bitOps) {
+  constexpr int32_t kWords = 100;
+  std::vector<uint64_t> left(kWords);
+  std::vector<uint64_t> right(kWords);
+  randomBits(left, 500);
+  randomBits(right, 500);
+
+  // Try ranges with partial edge words, whole words and sub-word spans.
+  std::vector<std::pair<int32_t, int32_t>> ranges = {
+      {0, kWords * 64},
+      {3, kWords * 64 - 9},
+      {64, kWords * 64 - 64},
+      {130, 140},
+      {7, 7}};
+  for (auto [begin, end] : ranges) {
+    auto reference = left;
+    auto test = left;
+    bits::andBits(reference.data(), right.data(), begin, end);
+    simd::andBits(test.data(), right.data(), begin, end);
+    EXPECT_EQ(reference, test) << "andBits [" << begin << ", " << end << ")";
+
+    reference = left;
+    test = left;
+    bits::orBits(reference.data(), right.data(), begin, end);
+    simd::orBits(test.data(), right.data(), begin, end);
+    EXPECT_EQ(reference, test) << "orBits [" << begin << ", " << end << ")";
+
+    reference = left;
+    test = left;
+    bits::andWithNegatedBits(reference.data(), right.data(), begin, end);
+    simd::andWithNegatedBits(test.data(), right.data(), begin, end);
+    EXPECT_EQ(reference, test)
+        << "andWithNegatedBits [" << begin << ", " << end << ")";
+
+    EXPECT_EQ(
+        bits::countBits(left.data(), begin, end),
+        simd::countBits(left.data(), begin, end))
+        << "countBits [" << begin << ", " << end << ")";
+  }
+}
+
 TEST_F(SimdUtilTest, crc32) {
   uint32_t checksum = 0;
   checksum = simd::crc32U64(0, 123456789);
@@ -18,6 +18,7 @@
 #include <folly/Singleton.h>
 #include <folly/init/Init.h>
 #include <gtest/gtest.h>
+#include <thread>
 #include <unordered_map>
 
 namespace facebook::velox {
@@ -87,6 +88,36 @@ folly::Singleton<BaseStatsReporter> reporter([]() {
   return new TestReporter();
 });
 
+TEST_F(StatsReporterTest, threadLocalReporter) {
+  ThreadLocalStatsReporter reporter;
+  reporter.addStatExportType("tl_stat1", StatType::SUM);
+  reporter.addStatExportType("tl_stat2", StatType::AVG);
+
+  reporter.addStatValue("tl_stat1", 10);
+  reporter.addStatValue("tl_stat1", 2);
+  reporter.addStatValue(std::string("tl_stat2"), 5);
+
+  // Counts reported on other threads are visible in the snapshot, both
+  // while the thread lives and after it exits.
+  std::thread([&]() {
+    reporter.addStatValue("tl_stat1", 100);
+    reporter.addStatValue("tl_stat2", 1);
+  }).join();
+
+  auto counters = reporter.snapshot();
+  EXPECT_EQ(112, counters["tl_stat1"].sum);
+  EXPECT_EQ(3, counters["tl_stat1"].count);
+  EXPECT_EQ(6, counters["tl_stat2"].sum);
+  EXPECT_EQ(2, counters["tl_stat2"].count);
+
+  EXPECT_EQ(StatType::SUM, reporter.statType("tl_stat1"));
+  EXPECT_EQ(StatType::COUNT, reporter.statType("unregistered"));
+
+  // Snapshots are monotonic.
+  reporter.addStatValue("tl_stat1");
+  EXPECT_EQ(113, reporter.snapshot()["tl_stat1"].sum);
+}
+
 } // namespace facebook::velox
 
 int main(int argc, char** argv) {
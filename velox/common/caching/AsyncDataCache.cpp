@@ -22,6 +22,8 @@
 #include <folly/executors/QueuedImmediateExecutor.h>
 #include "velox/common/caching/FileIds.h"
 
+#include <thread>
+
 namespace facebook::velox::cache {
 
 using memory::MachinePageCount;
@@ -186,6 +188,10 @@ CachePin CacheShard::findOrCreate(
       // entry still retain a valid read pin.
       found->key_.fileNum.clear();
     }
+    const auto keyHash = std::hash<RawFileCacheKey>()(key);
+    if (ghostSet_.erase(keyHash) > 0) {
+      ++ghostHits_;
+    }
     auto newEntry = getFreeEntryWithSize(size);
     // Initialize the members that must be set inside 'mutex_'.
     newEntry->numPins_ = AsyncDataCacheEntry::kExclusive;
@@ -365,6 +371,10 @@ void CacheShard::evict(uint64_t bytesToFree, bool evictAllUnpinned) {
           ++evictSaveableSkipped;
           continue;
         }
+        if (candidate->key_.fileNum.hasValue()) {
+          ghostInsertLocked(std::hash<RawFileCacheKey>()(RawFileCacheKey{
+              candidate->key_.fileNum.id(), candidate->key_.offset}));
+        }
         largeFreed += candidate->data_.byteSize();
         toFree.push_back(std::move(candidate->data()));
         removeEntryLocked(candidate);
@@ -421,8 +431,20 @@ void CacheShard::calibrateThreshold() {
       80);
 }
 
+void CacheShard::ghostInsertLocked(uint64_t keyHash) {
+  if (ghostSet_.insert(keyHash).second) {
+    ghostFifo_.push_back(keyHash);
+  }
+  const auto limit = std::max<size_t>(entries_.size(), 16);
+  while (ghostFifo_.size() > limit) {
+    ghostSet_.erase(ghostFifo_.front());
+    ghostFifo_.pop_front();
+  }
+}
+
 void CacheShard::updateStats(CacheStats& stats) {
   std::lock_guard<std::mutex> l(mutex_);
+  stats.ghostHits += ghostHits_;
   for (auto& entry : entries_) {
     if (!entry || !entry->key_.fileNum.hasValue()) {
       ++stats.numEmptyEntries;
@@ -482,21 +504,31 @@ AsyncDataCache::AsyncDataCache(
       ssdCache_(std::move(ssdCache)),
       cachedPages_(0),
       maxBytes_(maxBytes) {
-  for (auto i = 0; i < kNumShards; ++i) {
+  const auto count = numShards();
+  shardMask_ = count - 1;
+  for (auto i = 0; i < count; ++i) {
     shards_.push_back(std::make_unique<CacheShard>(this));
   }
 }
 
+// static
+int32_t AsyncDataCache::numShards() {
+  const auto cores = std::max<int32_t>(
+      1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+  return std::min<int32_t>(
+      256, std::max<int32_t>(4, bits::nextPowerOfTwo(cores / 2)));
+}
+
 CachePin AsyncDataCache::findOrCreate(
     RawFileCacheKey key,
     uint64_t size,
     folly::SemiFuture<bool>* wait) {
-  int shard = std::hash<RawFileCacheKey>()(key) & (kShardMask);
+  int shard = std::hash<RawFileCacheKey>()(key) & shardMask_;
   return shards_[shard]->findOrCreate(key, size, wait);
 }
 
 bool AsyncDataCache::exists(RawFileCacheKey key) const {
-  int shard = std::hash<RawFileCacheKey>()(key) & (kShardMask);
+  int shard = std::hash<RawFileCacheKey>()(key) & shardMask_;
   return shards_[shard]->exists(key);
 }
 
@@ -515,7 +547,7 @@ bool AsyncDataCache::makeSpace(
   // serialize with a mutex because memory arbitration must not be
   // called from inside a global mutex.
 
-  constexpr int32_t kMaxAttempts = kNumShards * 4;
+  const int32_t kMaxAttempts = shards_.size() * 4;
   // If requesting less than kSmallSizePages try up to 4x more if
   // first try failed.
   constexpr int32_t kSmallSizePages = 2048; // 8MB
@@ -568,9 +600,9 @@ bool AsyncDataCache::makeSpace(
     // Evict from next shard. If we have gone through all shards once
     // and still have not made the allocation, we go to desperate mode
     // with 'evictAllUnpinned' set to true.
-    shards_[shardCounter_ & (kShardMask)]->evict(
+    shards_[shardCounter_ & shardMask_]->evict(
         numPages * sizeMultiplier * MappedMemory::kPageSize,
-        nthAttempt >= kNumShards);
+        nthAttempt >= shards_.size());
     if (numPages < kSmallSizePages && sizeMultiplier < 4) {
       sizeMultiplier *= 2;
     }
@@ -684,7 +716,7 @@ std::string AsyncDataCache::toString() const {
           stats.largePadding
       << " / " << maxBytes_ << " bytes\n"
       << "Miss: " << stats.numNew << " Hit " << stats.numHit << " evict "
-      << stats.numEvict << "\n"
+      << stats.numEvict << " ghost hits " << stats.ghostHits << "\n"
       << " read pins " << stats.numShared << " write pins "
       << stats.numExclusive << " unused prefetch " << stats.numPrefetch
       << " Alloc Megaclocks " << (stats.allocClocks >> 20)
@@ -20,6 +20,7 @@
 
 #include <fmt/format.h>
 #include <folly/chrono/Hardware.h>
+#include <folly/container/F14Set.h>
 #include <folly/futures/SharedPromise.h>
 #include "velox/common/base/BitUtil.h"
 #include "velox/common/base/CoalesceIo.h"
@@ -440,6 +441,10 @@ class CoalescedLoad {
 // Struct for CacheShard stats. Stats from all shards are added into
 // this struct to provide a snapshot of state.
 struct CacheStats {
+  // Misses that would have been hits with roughly double the capacity,
+  // measured by a key-only ghost of recently evicted entries.
+  int64_t ghostHits{};
+
   // Total size in 'tynyData_'
   int64_t tinySize{};
   // Total size in 'data_'
@@ -519,6 +524,10 @@ class CacheShard {
   // Adds the stats of 'this' to 'stats'.
   void updateStats(CacheStats& stats);
 
+  // Records an evicted key hash in the ghost cache, bounding it to the
+  // live entry count. Called under 'mutex_'.
+  void ghostInsertLocked(uint64_t keyHash);
+
   // Appends a batch of non-saved SSD saveable entries in 'this' to
   // 'pins'. This may have to be called several times since this keeps
   // limits on the batch to write at one time. The saveable entries
@@ -548,6 +557,14 @@ class CacheShard {
   mutable std::mutex mutex_;
   folly::F14FastMap<RawFileCacheKey, AsyncDataCacheEntry * FOLLY_NONNULL>
       entryMap_;
+
+  // Ghost cache: key hashes of recently evicted entries, FIFO-bounded
+  // to the live entry count. A miss whose key is found here would have
+  // been a hit with roughly twice the capacity, so the ghostHits stat
+  // answers whether more RAM would help.
+  folly::F14FastSet<uint64_t> ghostSet_;
+  std::deque<uint64_t> ghostFifo_;
+  int64_t ghostHits_{0};
   // Entries associated to a key.
   std::deque<std::unique_ptr<AsyncDataCacheEntry>> entries_;
   // Unused indices in 'entries_'.
@@ -732,8 +749,11 @@ class AsyncDataCache : public memory::MappedMemory {
   }
 
  private:
-  static constexpr int32_t kNumShards = 4; // Must be power of 2.
-  static constexpr int32_t kShardMask = kNumShards - 1;
+  // Returns the shard count for this host: the power of 2 nearest
+  // above half the hardware concurrency, between 4 and 256. One mutex
+  // per shard, so scan-heavy hosts with many cores stop serializing
+  // findOrCreate on a handful of locks.
+  static int32_t numShards();
 
   // Waits a pseudorandom delay times 'counter'.
   void backoff(int32_t counter);
@@ -752,6 +772,10 @@ class AsyncDataCache : public memory::MappedMemory {
   std::shared_ptr<memory::MappedMemory> mappedMemory_;
   std::unique_ptr<SsdCache> ssdCache_;
   std::vector<std::unique_ptr<CacheShard>> shards_;
+
+  // shards_.size() - 1, for mapping key hashes to shards. Shard count
+  // is a power of 2.
+  int32_t shardMask_;
   int32_t shardCounter_{};
   std::atomic<memory::MachinePageCount> cachedPages_{0};
   // Number of pages that are allocated and not yet loaded or loaded
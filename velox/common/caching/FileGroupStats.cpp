@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/caching/FileGroupStats.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace facebook::velox::cache {
+
+void FileGroupStats::recordReference(
+    uint64_t /*fileId*/,
+    uint64_t groupId,
+    TrackingId trackingId,
+    int32_t bytes) {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (entries_.size() >= kMaxEntries &&
+      entries_.find(Key{groupId, trackingId}) == entries_.end()) {
+    return;
+  }
+  entries_[Key{groupId, trackingId}].data.incrementReference(bytes, 0);
+}
+
+void FileGroupStats::recordRead(
+    uint64_t /*fileId*/,
+    uint64_t groupId,
+    TrackingId trackingId,
+    int32_t bytes) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(Key{groupId, trackingId});
+  if (it == entries_.end()) {
+    return;
+  }
+  it->second.data.incrementRead(bytes);
+}
+
+void FileGroupStats::recordFile(
+    uint64_t /*fileId*/,
+    uint64_t groupId,
+    int32_t /*numStripes*/) {
+  std::lock_guard<std::mutex> l(mutex_);
+  ++groupNumFiles_[groupId];
+}
+
+bool FileGroupStats::shouldSaveToSsd(uint64_t groupId, TrackingId trackingId)
+    const {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (!hasFilter_) {
+    return true;
+  }
+  auto it = entries_.find(Key{groupId, trackingId});
+  if (it == entries_.end()) {
+    // No history, e.g. a table seen for the first time. Admit and let
+    // the next ranking decide.
+    return true;
+  }
+  return it->second.admitted;
+}
+
+void FileGroupStats::updateSsdFilter(uint64_t ssdSize, int32_t decayPct) {
+  std::lock_guard<std::mutex> l(mutex_);
+  hasFilter_ = true;
+  if (decayPct > 0) {
+    for (auto& [key, entry] : entries_) {
+      entry.data.referencedBytes -=
+          entry.data.referencedBytes * decayPct / 100;
+      entry.data.readBytes -= entry.data.readBytes * decayPct / 100;
+      entry.data.numReferences -= entry.data.numReferences * decayPct / 100;
+      entry.data.numReads -= entry.data.numReads * decayPct / 100;
+    }
+  }
+  // Rank entries by read density and admit the densest ones until
+  // their referenced bytes fill the capacity.
+  std::vector<Entry*> ranked;
+  ranked.reserve(entries_.size());
+  for (auto& [key, entry] : entries_) {
+    ranked.push_back(&entry);
+  }
+  std::sort(ranked.begin(), ranked.end(), [](Entry* left, Entry* right) {
+    return readDensity(left->data) > readDensity(right->data);
+  });
+  uint64_t admittedBytes = 0;
+  for (auto* entry : ranked) {
+    const auto entryBytes =
+        static_cast<uint64_t>(entry->data.referencedBytes);
+    // The densest entry is always admitted, even if alone it exceeds
+    // the capacity.
+    if (admittedBytes == 0 || admittedBytes + entryBytes <= ssdSize) {
+      entry->admitted = true;
+      admittedBytes += entryBytes;
+    } else {
+      entry->admitted = false;
+    }
+  }
+}
+
+std::string FileGroupStats::toString(uint64_t cacheBytes) const {
+  std::lock_guard<std::mutex> l(mutex_);
+  int64_t totalReferenced = 0;
+  int64_t admittedReferenced = 0;
+  int32_t numAdmitted = 0;
+  for (const auto& [key, entry] : entries_) {
+    totalReferenced += entry.data.referencedBytes;
+    if (entry.admitted) {
+      admittedReferenced += entry.data.referencedBytes;
+      ++numAdmitted;
+    }
+  }
+  std::stringstream out;
+  out << "FileGroupStats: " << entries_.size() << " tracked streams in "
+      << groupNumFiles_.size() << " groups, " << numAdmitted
+      << " admitted to SSD covering " << admittedReferenced << "/"
+      << totalReferenced << " referenced bytes, cache " << cacheBytes
+      << " bytes covers "
+      << (totalReferenced == 0
+              ? 100
+              : std::min<int64_t>(
+                    100, (100 * static_cast<int64_t>(cacheBytes)) /
+                        totalReferenced))
+      << "% of the tracked working set";
+  return out.str();
+}
+
+} // namespace facebook::velox::cache
@@ -16,48 +16,97 @@
 
 #pragma once
 
+#include <folly/container/F14Map.h>
+
 #include "velox/common/caching/ScanTracker.h"
 
 namespace facebook::velox::cache {
 
-// Dummy implementation of SsdCache admission stats.
+// SSD cache admission stats. Tracks access density per (file group,
+// stream) with the ScanTracker counters and admits to SSD only the
+// densest entries whose working set fits the SSD capacity. A one-off
+// full scan of a cold table accumulates references with few re-reads,
+// so its density stays below the admission threshold and it does not
+// flush the SSD working set.
 class FileGroupStats {
  public:
-  // Records ScanTracker::recordReference at group level
+  // Records ScanTracker::recordReference at group level.
   void recordReference(
-      uint64_t /*fileId*/,
-      uint64_t /*groupId*/,
-      TrackingId /*trackingId*/,
-      int32_t /*bytes*/) {}
+      uint64_t fileId,
+      uint64_t groupId,
+      TrackingId trackingId,
+      int32_t bytes);
 
-  // Records ScanTracker::recordRead at group level
+  // Records ScanTracker::recordRead at group level.
   void recordRead(
-      uint64_t /*fileId*/,
-      uint64_t /*groupId*/,
-      TrackingId /*trackingId*/,
-      int32_t /*bytes*/) {}
-
-  // Records the existence of a distinct file inside 'groupId'
-  void recordFile(
-      uint64_t /*fileId*/,
-      uint64_t /*groupId*/,
-      int32_t /*numStripes*/) {}
-
-  // Returns true if groupId, trackingId qualify the data to be cached to SSD.
-  bool shouldSaveToSsd(uint64_t /*groupId*/, TrackingId /*trackingId*/) const {
-    return true;
-  }
+      uint64_t fileId,
+      uint64_t groupId,
+      TrackingId trackingId,
+      int32_t bytes);
+
+  // Records the existence of a distinct file inside 'groupId'.
+  void recordFile(uint64_t fileId, uint64_t groupId, int32_t numStripes);
+
+  // Returns true if groupId, trackingId qualify the data to be cached
+  // to SSD. Optimistic for entries with no history and before the first
+  // updateSsdFilter call.
+  bool shouldSaveToSsd(uint64_t groupId, TrackingId trackingId) const;
 
-  // Updates the SSD selection criteria. 'ssdsize' is the capacity,
-  // 'decayPct' gives by how much old accesses are discounted.
-  void updateSsdFilter(uint64_t /*ssdSize*/, int32_t /*decayPct*/ = 0) {}
+  // Updates the SSD selection criteria. 'ssdSize' is the capacity,
+  // 'decayPct' gives by how much old accesses are discounted. Ranks
+  // tracked entries by read density and admits the densest ones whose
+  // cumulative referenced bytes fit 'ssdSize'.
+  void updateSsdFilter(uint64_t ssdSize, int32_t decayPct = 0);
 
   // Recalculates the best groups and makes a human readable
-  // summary. 'cacheBytes' is used to compute what fraction of the tracked
-  // working set can be cached in 'cacheBytes'.
-  std::string toString(uint64_t /*cacheBytes*/) {
-    return "<dummy FileGroupStats>";
+  // summary. 'cacheBytes' is used to compute what fraction of the
+  // tracked working set can be cached in 'cacheBytes'.
+  std::string toString(uint64_t cacheBytes) const;
+
+ private:
+  struct Key {
+    uint64_t groupId;
+    TrackingId trackingId;
+
+    bool operator==(const Key& other) const {
+      return groupId == other.groupId && trackingId == other.trackingId;
+    }
+  };
+
+  struct KeyHasher {
+    size_t operator()(const Key& key) const {
+      return folly::hasher<uint64_t>()(key.groupId) * 31 +
+          key.trackingId.hash();
+    }
+  };
+
+  struct Entry {
+    TrackingData data;
+
+    // True if the entry passed the last updateSsdFilter ranking.
+    bool admitted{true};
+  };
+
+  // Stops tracking new entries past this size; untracked entries are
+  // admitted optimistically.
+  static constexpr int32_t kMaxEntries = 1 << 18;
+
+  // Returns read bytes per 100 referenced bytes, the ranking measure
+  // for admission. Re-reads of the same data push this past 100.
+  static int64_t readDensity(const TrackingData& data) {
+    if (data.referencedBytes == 0) {
+      return 100;
+    }
+    return (100 * data.readBytes) / data.referencedBytes;
   }
+
+  mutable std::mutex mutex_;
+  folly::F14FastMap<Key, Entry, KeyHasher> entries_;
+  folly::F14FastMap<uint64_t, int32_t> groupNumFiles_;
+
+  // True after the first updateSsdFilter call. Until then everything is
+  // admitted.
+  bool hasFilter_{false};
 };
 
 } // namespace facebook::velox::cache
@@ -16,6 +16,7 @@
 
 #include "velox/common/caching/SsdFile.h"
 #include <folly/Executor.h>
+#include <folly/futures/Future.h>
 #include <folly/portability/SysUio.h>
 #include "velox/common/base/AsyncSource.h"
 #include "velox/common/caching/FileIds.h"
@@ -201,6 +202,14 @@ CoalesceIoStats SsdFile::load(
   // Do coalesced IO for the pins. For short payloads, the break-even
   // between discrete pread calls and a single preadv that discards
   // gaps is ~25K per gap. For longer payloads this is ~50-100K.
+  //
+  // With an asynchronous ReadFile (e.g. an io_uring backed one), all
+  // coalesced batches of the load are queued before waiting, so the
+  // device sees the whole load at queue depth instead of one preadv at
+  // a time. The buffers point into the pinned cache entries, so the
+  // reads land in place either way. The synchronous path is the
+  // fallback.
+  std::vector<folly::SemiFuture<uint64_t>> batches;
   auto stats = readPins(
       pins,
       payloadTotal / pins.size() < 10000 ? 25000 : 50000,
@@ -214,8 +223,29 @@ CoalesceIoStats SsdFile::load(
           int32_t /*end*/,
           uint64_t offset,
           const std::vector<folly::Range<char*>>& buffers) {
-        read(offset, buffers);
+        if (readFile_->hasPreadvAsync()) {
+          batches.push_back(readFile_->preadvAsync(offset, buffers));
+        } else {
+          read(offset, buffers);
+        }
       });
+  if (!batches.empty()) {
+    // Wait for every queued batch before surfacing an error: all of
+    // them write into the pinned entries.
+    std::exception_ptr error;
+    for (auto& batch : batches) {
+      try {
+        std::move(batch).get();
+      } catch (const std::exception&) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
 
   for (auto i = 0; i < ssdPins.size(); ++i) {
     pins[i].checkedEntry()->setSsdFile(this, ssdPins[i].run().offset());
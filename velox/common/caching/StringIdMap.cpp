@@ -19,48 +19,54 @@
 namespace facebook::velox {
 
 uint64_t StringIdMap::id(std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = stringToId_.find(string);
-  if (it != stringToId_.end()) {
+  auto& shard = shardForString(string);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.stringToId.find(string);
+  if (it != shard.stringToId.end()) {
     return it->second;
   }
   return kNoId;
 }
 
 void StringIdMap::release(uint64_t id) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = idToString_.find(id);
-  if (it != idToString_.end()) {
+  auto& shard = shardForId(id);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.idToString.find(id);
+  if (it != shard.idToString.end()) {
     VELOX_CHECK_LT(
         0, it->second.numInUse, "Extra release of id in StringIdMap");
     if (--it->second.numInUse == 0) {
-      pinnedSize_ -= it->second.string.size();
-      auto strIter = stringToId_.find(it->second.string);
-      assert(strIter != stringToId_.end());
-      stringToId_.erase(strIter);
-      idToString_.erase(it);
+      shard.pinnedSize -= it->second.string.size();
+      auto strIter = shard.stringToId.find(it->second.string);
+      assert(strIter != shard.stringToId.end());
+      shard.stringToId.erase(strIter);
+      shard.idToString.erase(it);
     }
   }
 }
 
 void StringIdMap::addReference(uint64_t id) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = idToString_.find(id);
+  auto& shard = shardForId(id);
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.idToString.find(id);
   VELOX_CHECK(
-      it != idToString_.end(),
+      it != shard.idToString.end(),
       "Trying to add a reference to an id that is not in StringIdMap");
 
   ++it->second.numInUse;
 }
 
 uint64_t StringIdMap::makeId(std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = stringToId_.find(string);
-  if (it != stringToId_.end()) {
-    auto entry = idToString_.find(it->second);
-    VELOX_CHECK(entry != idToString_.end());
+  const uint64_t shardIndex =
+      std::hash<std::string_view>()(string) & (kNumShards - 1);
+  auto& shard = shards_[shardIndex];
+  std::lock_guard<std::mutex> l(shard.mutex);
+  auto it = shard.stringToId.find(string);
+  if (it != shard.stringToId.end()) {
+    auto entry = shard.idToString.find(it->second);
+    VELOX_CHECK(entry != shard.idToString.end());
     if (++entry->second.numInUse == 1) {
-      pinnedSize_ += entry->second.string.size();
+      shard.pinnedSize += entry->second.string.size();
     }
 
     return it->second;
@@ -73,14 +79,14 @@ uint64_t StringIdMap::makeId(std::string_view string) {
   // have a low cap since the number of mappings would in practice
   // be in the 100K range.
   do {
-    entry.id = ++lastId_;
-  } while (idToString_.find(entry.id) != idToString_.end());
+    entry.id = (++shard.lastId << kShardBits) | shardIndex;
+  } while (shard.idToString.find(entry.id) != shard.idToString.end());
   entry.numInUse = 1;
-  pinnedSize_ += entry.string.size();
+  shard.pinnedSize += entry.string.size();
   auto id = entry.id;
-  auto& entryInTable = idToString_[id] = std::move(entry);
-  stringToId_[entryInTable.string] = entry.id;
-  return lastId_;
+  auto& entryInTable = shard.idToString[id] = std::move(entry);
+  shard.stringToId[entryInTable.string] = id;
+  return id;
 }
 
 } // namespace facebook::velox
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <string_view>
 
 #include <folly/container/F14Map.h>
@@ -41,7 +44,11 @@ class StringIdMap {
   // Returns the total length of strings involved in currently referenced
   // mappings.
   int64_t pinnedSize() const {
-    return pinnedSize_;
+    int64_t size = 0;
+    for (const auto& shard : shards_) {
+      size += shard.pinnedSize;
+    }
+    return size;
   }
 
   // Returns the id for 'string' and increments its use count. Assigns a
@@ -58,23 +65,43 @@ class StringIdMap {
   // Returns a copy of the string associated with id or empty string if id has
   // no string.
   std::string string(uint64_t id) {
-    std::lock_guard<std::mutex> l(mutex_);
-    auto it = idToString_.find(id);
-    return it == idToString_.end() ? "" : it->second.string;
+    auto& shard = shardForId(id);
+    std::lock_guard<std::mutex> l(shard.mutex);
+    auto it = shard.idToString.find(id);
+    return it == shard.idToString.end() ? "" : it->second.string;
   }
 
  private:
+  // The map is sharded by string hash so that concurrent scans opening
+  // many files do not serialize on one mutex. Ids carry their shard in
+  // the low bits, so release and addReference find the owning shard
+  // without knowing the string.
+  static constexpr int32_t kShardBits = 4;
+  static constexpr int32_t kNumShards = 1 << kShardBits;
+
   struct Entry {
     std::string string;
     uint64_t id;
     uint32_t numInUse{};
   };
 
-  std::mutex mutex_;
-  folly::F14FastMap<std::string, uint64_t> stringToId_;
-  folly::F14FastMap<uint64_t, Entry> idToString_;
-  uint64_t lastId_{};
-  uint64_t pinnedSize_{};
+  struct Shard {
+    std::mutex mutex;
+    folly::F14FastMap<std::string, uint64_t> stringToId;
+    folly::F14FastMap<uint64_t, Entry> idToString;
+    uint64_t lastId{0};
+    std::atomic<int64_t> pinnedSize{0};
+  };
+
+  Shard& shardForString(std::string_view string) {
+    return shards_[std::hash<std::string_view>()(string) & (kNumShards - 1)];
+  }
+
+  Shard& shardForId(uint64_t id) {
+    return shards_[id & (kNumShards - 1)];
+  }
+
+  std::array<Shard, kNumShards> shards_;
 };
 
 // Keeps a string-id association live for the duration of this.
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/FileGroupStats.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox::cache;
+
+TEST(FileGroupStatsTest, admission) {
+  constexpr uint64_t kMB = 1 << 20;
+  FileGroupStats stats;
+  TrackingId column(1);
+
+  // Everything is admitted before the first filter update.
+  EXPECT_TRUE(stats.shouldSaveToSsd(1, column));
+
+  // Group 1 is re-read 4 times, group 2 is scanned once.
+  stats.recordReference(10, 1, column, 10 * kMB);
+  for (auto i = 0; i < 4; ++i) {
+    stats.recordRead(10, 1, column, 10 * kMB);
+  }
+  stats.recordReference(20, 2, column, 100 * kMB);
+  stats.recordRead(20, 2, column, 100 * kMB);
+
+  // Capacity fits only the dense group.
+  stats.updateSsdFilter(20 * kMB);
+  EXPECT_TRUE(stats.shouldSaveToSsd(1, column));
+  EXPECT_FALSE(stats.shouldSaveToSsd(2, column));
+
+  // Unknown groups stay admitted optimistically.
+  EXPECT_TRUE(stats.shouldSaveToSsd(3, column));
+
+  // With capacity for everything, both qualify.
+  stats.updateSsdFilter(1000 * kMB);
+  EXPECT_TRUE(stats.shouldSaveToSsd(1, column));
+  EXPECT_TRUE(stats.shouldSaveToSsd(2, column));
+
+  // Decay discounts history but keeps the ranking.
+  stats.updateSsdFilter(20 * kMB, 50);
+  EXPECT_TRUE(stats.shouldSaveToSsd(1, column));
+  EXPECT_FALSE(stats.shouldSaveToSsd(2, column));
+}
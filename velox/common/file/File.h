@@ -64,7 +64,10 @@ class ReadFile {
 
   // Like preadv but may execute asynchronously and returns the read
   // size or exception via SemiFuture. Use hasPreadvAsync() to check
-  // if the implementation is in fact asynchronous.
+  // if the implementation is in fact asynchronous. Asynchronous
+  // implementations must capture the ranges in 'buffers': the caller
+  // may destroy the vector as soon as this returns, while the ranges'
+  // target memory stays live until the future completes.
   virtual folly::SemiFuture<uint64_t> preadvAsync(
       uint64_t offset,
       const std::vector<folly::Range<char*>>& buffers) const {
@@ -191,7 +194,13 @@ class InMemoryWriteFile final : public WriteFile {
 
 class LocalReadFile final : public ReadFile {
  public:
-  explicit LocalReadFile(std::string_view path);
+  /// 'directIo' opens the file with O_DIRECT where supported, bypassing
+  /// the OS page cache: the right mode when AsyncDataCache already
+  /// holds the data and kernel caching only costs CPU. Reads are
+  /// aligned to the direct IO block size through an internal aligned
+  /// scratch buffer. Falls back to buffered reads on platforms and
+  /// filesystems without O_DIRECT support.
+  explicit LocalReadFile(std::string_view path, bool directIo = false);
 
   explicit LocalReadFile(int32_t fd);
 
@@ -216,8 +225,20 @@ class LocalReadFile final : public ReadFile {
   void preadInternal(uint64_t offset, uint64_t length, char* FOLLY_NONNULL pos)
       const;
 
+  // Reads with O_DIRECT alignment handling. Returns false if the
+  // kernel refused the direct read, in which case the caller retries
+  // buffered.
+  bool directPread(uint64_t offset, uint64_t length, char* FOLLY_NONNULL pos)
+      const;
+
+  // Clears O_DIRECT from 'fd_' after a failed direct read.
+  void disableDirectIo() const;
+
   int32_t fd_;
   long size_;
+
+  // True while reads go through the O_DIRECT path.
+  mutable std::atomic<bool> directIo_{false};
 };
 
 class LocalWriteFile final : public WriteFile {
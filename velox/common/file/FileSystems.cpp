@@ -84,7 +84,11 @@ class LocalFileSystem : public FileSystem {
   }
 
   std::unique_ptr<ReadFile> openFileForRead(std::string_view path) override {
-    return std::make_unique<LocalReadFile>(extractPath(path));
+    // Direct IO bypasses the page cache; right when a userspace cache
+    // such as AsyncDataCache fronts the reads.
+    const bool directIo =
+        config_ && config_->get<bool>("file.direct-io", false);
+    return std::make_unique<LocalReadFile>(extractPath(path), directIo);
   }
 
   std::unique_ptr<WriteFile> openFileForWrite(std::string_view path) override {
@@ -30,6 +30,18 @@ class WriteFile;
 namespace facebook::velox::filesystems {
 
 // An abstract FileSystem
+/// IO cost profile of a storage tier. Consumed by read planners to
+/// decide how aggressively to coalesce nearby reads: merging a gap is
+/// worth it when reading the gap bytes costs less than paying another
+/// request's fixed latency.
+struct IoProfile {
+  /// Sustained sequential bandwidth of one stream.
+  int64_t bandwidthBytesPerSecond;
+
+  /// Fixed cost of one read request, queueing and round trip included.
+  int32_t requestLatencyUs;
+};
+
 class FileSystem {
  public:
   FileSystem(std::shared_ptr<const Config> config)
@@ -39,6 +51,14 @@ class FileSystem {
   // Returns the name of the File System
   virtual std::string name() const = 0;
 
+  /// Returns the IO cost profile of the storage behind this file
+  /// system. The default describes a local NVMe class device; remote
+  /// stores like S3 should report their per-request latency and
+  /// per-stream bandwidth so read planners merge larger gaps.
+  virtual IoProfile ioProfile() const {
+    return {2LL << 30 /*2GB/s*/, 250 /*us*/};
+  }
+
   // Returns a ReadFile handle for a given file path
   virtual std::unique_ptr<ReadFile> openFileForRead(std::string_view path) = 0;
 
@@ -17,6 +17,9 @@
 
 #include <exception>
 #include <sstream>
+
+#include <xsimd/xsimd.hpp>
+
 #include "velox/common/base/IOUtils.h"
 #include "velox/common/hyperloglog/BiasCorrection.h"
 #include "velox/common/hyperloglog/HllUtils.h"
@@ -562,12 +565,54 @@ void DenseHll::mergeWith(const char* serialized) {
   mergeWith(baseline, deltas, overflows, overflowBuckets, overflowValues);
 }
 
+bool DenseHll::mergeNoOverflows(
+    int8_t otherBaseline,
+    const int8_t* otherDeltas,
+    int16_t otherOverflows) {
+  if (baseline_ != otherBaseline || overflows_ != 0 || otherOverflows != 0) {
+    return false;
+  }
+  // With equal baselines and no overflows the merge is a per-bucket max
+  // of 4-bit deltas. Masking confines each nibble to its byte, so a
+  // byte-wise SIMD max merges both buckets of a byte at once.
+  auto* deltas = reinterpret_cast<uint8_t*>(deltas_.data());
+  const auto* other = reinterpret_cast<const uint8_t*>(otherDeltas);
+  const size_t size = deltas_.size();
+  constexpr size_t kBatch = xsimd::batch<uint8_t>::size;
+  const auto lowMask = xsimd::batch<uint8_t>::broadcast(0x0f);
+  size_t i = 0;
+  for (; i + kBatch <= size; i += kBatch) {
+    const auto left = xsimd::batch<uint8_t>::load_unaligned(deltas + i);
+    const auto right = xsimd::batch<uint8_t>::load_unaligned(other + i);
+    const auto low = xsimd::max(left & lowMask, right & lowMask);
+    const auto high = xsimd::max(left & ~lowMask, right & ~lowMask);
+    (low | high).store_unaligned(deltas + i);
+  }
+  for (; i < size; ++i) {
+    const uint8_t left = deltas[i];
+    const uint8_t right = other[i];
+    deltas[i] = std::max<uint8_t>(left & 0x0f, right & 0x0f) |
+        std::max<uint8_t>(left & 0xf0, right & 0xf0);
+  }
+  // Recount zero deltas against the unchanged baseline.
+  int32_t baselineCount = 0;
+  for (size_t slot = 0; slot < size; ++slot) {
+    baselineCount += ((deltas[slot] & 0x0f) == 0) + ((deltas[slot] & 0xf0) == 0);
+  }
+  baselineCount_ = baselineCount;
+  adjustBaselineIfNeeded();
+  return true;
+}
+
 void DenseHll::mergeWith(
     int8_t otherBaseline,
     const int8_t* otherDeltas,
     int16_t otherOverflows,
     const uint16_t* otherOverflowBuckets,
     const int8_t* otherOverflowValues) {
+  if (mergeNoOverflows(otherBaseline, otherDeltas, otherOverflows)) {
+    return;
+  }
   int8_t newBaseline = std::max(baseline_, otherBaseline);
   int32_t baselineCount = 0;
 
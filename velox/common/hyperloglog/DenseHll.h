@@ -116,6 +116,15 @@ class DenseHll {
       const uint16_t* otherOverflowBuckets,
       const int8_t* otherOverflowValues);
 
+  // Merge for the common case of equal baselines and no overflows on
+  // either side: a SIMD nibble-wise max over the packed delta bytes.
+  // Returns false if the preconditions do not hold and the general
+  // per-bucket merge must run.
+  bool mergeNoOverflows(
+      int8_t otherBaseline,
+      const int8_t* otherDeltas,
+      int16_t otherOverflows);
+
   /// Number of first bits of the hash to calculate buckets from.
   int8_t indexBitLength_;
 
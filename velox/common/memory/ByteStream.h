@@ -274,14 +274,12 @@ class ByteStream {
           values.size() * sizeof(T)));
       return;
     }
-    auto target = reinterpret_cast<T*>(current_->buffer + current_->position);
-    auto end = target + values.size();
-    auto valuePtr = &values[0];
-    while (target != end) {
-      *target = *valuePtr;
-      ++target;
-      ++valuePtr;
-    }
+    // One capacity check, then a single wide copy: this is the bulk
+    // column append under serialization inner loops.
+    memcpy(
+        current_->buffer + current_->position,
+        &values[0],
+        sizeof(T) * values.size());
     current_->position += sizeof(T) * values.size();
   }
 
@@ -84,7 +84,8 @@ HashStringAllocator::Position HashStringAllocator::newWrite(
       !currentHeader_,
       "Do not call newWrite before finishing the previous write to "
       "HashStringAllocator");
-  currentHeader_ = allocate(preferredSize, false);
+  currentHeader_ = bumpAllocation_ ? allocateFromBumpRun(preferredSize)
+                                   : allocate(preferredSize, false);
 
   stream.setRange(ByteRange{
       reinterpret_cast<uint8_t*>(currentHeader_->begin()),
@@ -94,6 +95,46 @@ HashStringAllocator::Position HashStringAllocator::newWrite(
   return Position{currentHeader_, currentHeader_->begin()};
 }
 
+void HashStringAllocator::setBumpAllocation(bool enabled) {
+  bumpAllocation_ = enabled;
+  if (!enabled && bumpRun_ != nullptr) {
+    // The run is not in 'cumulativeBytes_', rebalance before free()
+    // subtracts it.
+    cumulativeBytes_ += bumpRun_->size();
+    free(bumpRun_);
+    bumpRun_ = nullptr;
+  }
+}
+
+HashStringAllocator::Header* HashStringAllocator::allocateFromBumpRun(
+    int32_t preferredSize) {
+  preferredSize = std::max(preferredSize, kMinAlloc);
+  if (bumpRun_ != nullptr && bumpRun_->size() < preferredSize) {
+    cumulativeBytes_ += bumpRun_->size();
+    free(bumpRun_);
+    bumpRun_ = nullptr;
+  }
+  if (bumpRun_ == nullptr) {
+    bumpRun_ = allocate(std::max<int32_t>(preferredSize, kBumpRunBytes), false);
+    // The run counts in 'cumulativeBytes_' as values are carved from
+    // it, not at reservation, keeping per-row size tracking intact.
+    cumulativeBytes_ -= bumpRun_->size();
+  }
+  auto* header = bumpRun_;
+  const int32_t rest = header->size() - preferredSize - sizeof(Header);
+  if (rest <= kMinAlloc) {
+    // Too little left to keep as a run, the value takes the whole
+    // block.
+    bumpRun_ = nullptr;
+    cumulativeBytes_ += header->size();
+    return header;
+  }
+  header->setSize(preferredSize);
+  bumpRun_ = new (header->end()) Header(rest);
+  cumulativeBytes_ += header->size();
+  return header;
+}
+
 void HashStringAllocator::extendWrite(Position position, ByteStream& stream) {
   auto header = position.header;
   VELOX_CHECK_LE(
@@ -138,10 +179,26 @@ HashStringAllocator::Position HashStringAllocator::finishWrite(
     free(getNextContinued(currentHeader_));
     currentHeader_->clearContinued();
   }
-  // Free remainder of block if there is a lot left over.
-  freeRestOfBlock(
-      currentHeader_,
-      writePosition - currentHeader_->begin() + numReserveBytes);
+  if (bumpAllocation_ && bumpRun_ != nullptr &&
+      reinterpret_cast<Header*>(currentHeader_->end()) == bumpRun_) {
+    // Give the unwritten tail back to the adjacent bump run by moving
+    // the run header back, pointer arithmetic only.
+    const int32_t keep = std::max<int32_t>(
+        writePosition - currentHeader_->begin() + numReserveBytes, kMinAlloc);
+    const int32_t excess = currentHeader_->size() - keep;
+    if (excess > 0) {
+      const int32_t runSize = bumpRun_->size() + excess;
+      currentHeader_->setSize(keep);
+      bumpRun_ = new (currentHeader_->end()) Header(runSize);
+      // The returned tail moves from the value to the uncounted run.
+      cumulativeBytes_ -= excess;
+    }
+  } else {
+    // Free remainder of block if there is a lot left over.
+    freeRestOfBlock(
+        currentHeader_,
+        writePosition - currentHeader_->begin() + numReserveBytes);
+  }
   currentHeader_ = nullptr;
   return currentPos;
 }
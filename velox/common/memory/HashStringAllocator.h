@@ -266,10 +266,20 @@ class HashStringAllocator : public StreamArena {
   void clear() {
     numFree_ = 0;
     freeBytes_ = 0;
+    bumpRun_ = nullptr;
     new (&free_) CompactDoubleList();
     pool_.clear();
   }
 
+  /// Enables or disables bump allocation. When enabled, newWrite carves
+  /// each value's block from a privately reserved run with pointer
+  /// arithmetic only and finishWrite gives the unwritten tail back to
+  /// the run, so consecutive writes skip the free-list round trip per
+  /// value. The run is replenished from the free list when it runs out.
+  /// Carved values have regular headers and are freed individually
+  /// through free(). Disabling returns the unused run.
+  void setBumpAllocation(bool enabled);
+
   memory::MappedMemory* FOLLY_NONNULL mappedMemory() const {
     return pool_.mappedMemory();
   }
@@ -321,6 +331,14 @@ class HashStringAllocator : public StreamArena {
   // blocks would be below minimum size.
   void freeRestOfBlock(Header* FOLLY_NONNULL header, int32_t keepBytes);
 
+  // Size of the run reserved for bump allocation.
+  static constexpr int32_t kBumpRunBytes = 16 * 1024;
+
+  // Carves a block of at least 'preferredSize' from the front of
+  // 'bumpRun_', replenishing the run when it is too small. The result
+  // is owned by the caller like an allocate() result.
+  Header* FOLLY_NONNULL allocateFromBumpRun(int32_t preferredSize);
+
   // Circular list of free blocks.
   CompactDoubleList free_;
 
@@ -340,6 +358,13 @@ class HashStringAllocator : public StreamArena {
   // progress.
   Header* FOLLY_NULLABLE currentHeader_ = nullptr;
 
+  // True if newWrite carves blocks from 'bumpRun_'.
+  bool bumpAllocation_ = false;
+
+  // Block values are carved from under bump allocation, nullptr if none
+  // reserved. Allocated state, not on the free list.
+  Header* FOLLY_NULLABLE bumpRun_ = nullptr;
+
   // Pool for getting new slabs.
   AllocationPool pool_;
 };
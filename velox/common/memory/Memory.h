@@ -880,7 +880,10 @@ void MemoryPoolImpl<Allocator, ALIGNMENT>::reserve(int64_t size) {
 
   bool success = memoryManager_.reserve(size);
   bool manualCap = isMemoryCapped();
-  int64_t aggregateBytes = getAggregateBytes();
+  // The subtree walk behind getAggregateBytes takes a shared mutex per
+  // allocation; skip it when there is no cap to compare against, the
+  // default for expression intermediates.
+  int64_t aggregateBytes = cap_ == kMaxMemory ? 0 : getAggregateBytes();
   if (UNLIKELY(!success || manualCap || aggregateBytes > cap_)) {
     // NOTE: If we can make the reserve and release a single transaction we
     // would have more accurate aggregates in intermediate states. However, this
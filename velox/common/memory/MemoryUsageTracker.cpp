@@ -15,6 +15,9 @@
  */
 
 #include "velox/common/memory/MemoryUsageTracker.h"
+
+#include <algorithm>
+
 #include "velox/common/base/SuccinctPrinter.h"
 
 namespace facebook::velox::memory {
@@ -149,7 +152,20 @@ void MemoryUsageTracker::incrementUsage(UsageType type, int64_t size) {
   int64_t totalBytes = newUsage + usage(currentUsageInBytes_, otherUsageType);
 
   // Enforce the limit.
-  if (newUsage > usage(maxMemory_, type) || totalBytes > total(maxMemory_)) {
+  bool exceeded =
+      newUsage > usage(maxMemory_, type) || totalBytes > total(maxMemory_);
+  if (exceeded && hasReclaimCallbacks_ &&
+      tryReclaim(std::max<int64_t>(
+          newUsage - usage(maxMemory_, type),
+          totalBytes - total(maxMemory_))) > 0) {
+    // Registered reclaimers shed reusable state and decremented the
+    // counters; re-evaluate before consulting the grow callback.
+    newUsage = usage(currentUsageInBytes_, type).load(std::memory_order_relaxed);
+    totalBytes = newUsage + usage(currentUsageInBytes_, otherUsageType);
+    exceeded =
+        newUsage > usage(maxMemory_, type) || totalBytes > total(maxMemory_);
+  }
+  if (exceeded) {
     if (!growCallback_ || !growCallback_(type, size, *this)) {
       // Exceeded the limit.  revert the change to current usage.
       decrementUsage(type, size);
@@ -170,6 +186,51 @@ void MemoryUsageTracker::incrementUsage(UsageType type, int64_t size) {
   checkNonNegativeSizes("after update");
 }
 
+int64_t MemoryUsageTracker::registerReclaimCallback(
+    int32_t tier,
+    ReclaimCallback callback) {
+  std::lock_guard<std::mutex> l(reclaimMutex_);
+  const auto id = nextReclaimId_++;
+  reclaimCallbacks_.push_back(ReclaimEntry{id, tier, std::move(callback)});
+  std::sort(
+      reclaimCallbacks_.begin(),
+      reclaimCallbacks_.end(),
+      [](const ReclaimEntry& left, const ReclaimEntry& right) {
+        return left.tier < right.tier;
+      });
+  hasReclaimCallbacks_ = true;
+  return id;
+}
+
+void MemoryUsageTracker::unregisterReclaimCallback(int64_t id) {
+  std::lock_guard<std::mutex> l(reclaimMutex_);
+  reclaimCallbacks_.erase(
+      std::remove_if(
+          reclaimCallbacks_.begin(),
+          reclaimCallbacks_.end(),
+          [id](const ReclaimEntry& entry) { return entry.id == id; }),
+      reclaimCallbacks_.end());
+  hasReclaimCallbacks_ = !reclaimCallbacks_.empty();
+}
+
+int64_t MemoryUsageTracker::tryReclaim(int64_t targetBytes) {
+  // Copy the registry so callbacks run without the mutex and may
+  // themselves register or unregister.
+  std::vector<ReclaimEntry> callbacks;
+  {
+    std::lock_guard<std::mutex> l(reclaimMutex_);
+    callbacks = reclaimCallbacks_;
+  }
+  int64_t freed = 0;
+  for (const auto& entry : callbacks) {
+    freed += entry.callback(targetBytes - freed);
+    if (freed >= targetBytes) {
+      break;
+    }
+  }
+  return freed;
+}
+
 void MemoryUsageTracker::decrementUsage(UsageType type, int64_t size) noexcept {
   if (parent_) {
     parent_->decrementUsage(type, size);
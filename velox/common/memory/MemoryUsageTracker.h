@@ -241,6 +241,27 @@ class MemoryUsageTracker
     growCallback_ = func;
   }
 
+  /// Callback reclaiming up to 'targetBytes' of reusable memory
+  /// accounted to this tracker, returning the bytes actually freed.
+  /// Called on the allocating thread when an allocation would exceed
+  /// the limit, possibly concurrently with the owner of the registered
+  /// state, so implementations must be thread safe. They may free
+  /// tracked memory (the counters are re-read afterwards) but must not
+  /// allocate.
+  using ReclaimCallback = std::function<int64_t(int64_t targetBytes)>;
+
+  /// Registers 'callback' for cooperative reclamation before a memory
+  /// cap error: when an allocation exceeds the limit, callbacks run in
+  /// ascending 'tier' order until enough is freed, before the grow
+  /// callback is consulted or MEM_CAP_EXCEEDED is thrown. Put cheaply
+  /// rebuilt state, e.g. recycling pools, in low tiers and expensive
+  /// state in higher ones. Returns an id for
+  /// unregisterReclaimCallback; the callback must stay valid and must
+  /// be unregistered before its state is destroyed.
+  int64_t registerReclaimCallback(int32_t tier, ReclaimCallback callback);
+
+  void unregisterReclaimCallback(int64_t id);
+
   void setMakeMemoryCapExceededMessage(MakeMemoryCapExceededMessage func) {
     makeMemoryCapExceededMessage_ = func;
   }
@@ -393,6 +414,27 @@ class MemoryUsageTracker
   GrowCallback growCallback_{};
 
   MakeMemoryCapExceededMessage makeMemoryCapExceededMessage_{};
+
+  struct ReclaimEntry {
+    int64_t id;
+    int32_t tier;
+    ReclaimCallback callback;
+  };
+
+  // Runs registered reclaim callbacks in tier order until
+  // 'targetBytes' are freed. Returns the total freed. Invoked without
+  // holding any tracker mutex.
+  int64_t tryReclaim(int64_t targetBytes);
+
+  // Serializes 'reclaimCallbacks_'. Never held while running a
+  // callback.
+  std::mutex reclaimMutex_;
+  std::vector<ReclaimEntry> reclaimCallbacks_;
+  int64_t nextReclaimId_{1};
+
+  // True if any callbacks registered, checked before taking
+  // 'reclaimMutex_' on the allocation path.
+  std::atomic<bool> hasReclaimCallbacks_{false};
 };
 
 // A temporary solution to MemoryUsageTracker accounting leak without properly
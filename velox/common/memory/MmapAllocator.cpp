@@ -19,11 +19,54 @@
 #include "velox/common/testutil/TestValue.h"
 
 #include <sys/mman.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 using facebook::velox::common::testutil::TestValue;
 
 namespace facebook::velox::memory {
 
+namespace {
+// Applies the configured NUMA memory policy to [ptr, ptr + size) with
+// mbind, best effort: failures and platforms without the syscall keep
+// the default first-touch policy. Invoked through raw syscall to avoid
+// a libnuma dependency.
+void applyNumaPolicy(
+    void* FOLLY_NONNULL ptr,
+    size_t size,
+    int32_t bindNode,
+    uint64_t interleaveMask) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // From linux/mempolicy.h.
+  constexpr int kMpolBind = 2;
+  constexpr int kMpolInterleave = 3;
+  int mode;
+  uint64_t nodeMask;
+  if (bindNode >= 0 && bindNode < 64) {
+    mode = kMpolBind;
+    nodeMask = 1UL << bindNode;
+  } else if (interleaveMask != 0) {
+    mode = kMpolInterleave;
+    nodeMask = interleaveMask;
+  } else {
+    return;
+  }
+  if (syscall(
+          SYS_mbind,
+          ptr,
+          size,
+          mode,
+          &nodeMask,
+          sizeof(nodeMask) * 8,
+          0UL) < 0) {
+    LOG(WARNING) << "mbind got errno " << errno;
+  }
+#endif
+}
+} // namespace
+
 MmapAllocator::MmapAllocator(const MmapAllocatorOptions& options)
     : MappedMemory(),
       numAllocated_(0),
@@ -31,9 +74,17 @@ MmapAllocator::MmapAllocator(const MmapAllocatorOptions& options)
       capacity_(bits::roundUp(
           options.capacity / kPageSize,
           64 * sizeClassSizes_.back())),
-      useMmapArena_(options.useMmapArena) {
+      useMmapArena_(options.useMmapArena),
+      useHugePages_(options.useHugePages),
+      numaBindNode_(options.numaBindNode),
+      numaInterleaveMask_(options.numaInterleaveMask) {
   for (int size : sizeClassSizes_) {
-    sizeClasses_.push_back(std::make_unique<SizeClass>(capacity_ / size, size));
+    sizeClasses_.push_back(std::make_unique<SizeClass>(
+        capacity_ / size,
+        size,
+        useHugePages_ && size >= kMinHugePageClassPages,
+        numaBindNode_,
+        numaInterleaveMask_));
   }
 
   if (useMmapArena_) {
@@ -291,6 +342,17 @@ bool MmapAllocator::allocateContiguousImpl(
           MAP_PRIVATE | MAP_ANONYMOUS,
           -1,
           0);
+      if (data && data != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+        if (useHugePages_ && numPages * kPageSize >= kHugePageSize) {
+          // Best effort: the mapping keeps 4KB pages if the kernel
+          // declines.
+          madvise(data, numPages * kPageSize, MADV_HUGEPAGE);
+        }
+#endif
+        applyNumaPolicy(
+            data, numPages * kPageSize, numaBindNode_, numaInterleaveMask_);
+      }
     }
   }
   if (!data) {
@@ -339,7 +401,12 @@ MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   return numAway;
 }
 
-MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
+MmapAllocator::SizeClass::SizeClass(
+    size_t capacity,
+    MachinePageCount unitSize,
+    bool useHugePages,
+    int32_t numaBindNode,
+    uint64_t numaInterleaveMask)
     : capacity_(capacity),
       unitSize_(unitSize),
       byteSize_(capacity_ * unitSize_ * kPageSize),
@@ -364,6 +431,15 @@ MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
         "mmap failed with {}",
         errno);
   }
+#ifdef MADV_HUGEPAGE
+  if (useHugePages) {
+    // Best effort: the arena keeps 4KB pages if the kernel declines.
+    if (madvise(ptr, byteSize_, MADV_HUGEPAGE) < 0) {
+      LOG(WARNING) << "madvise(MADV_HUGEPAGE) got errno " << errno;
+    }
+  }
+#endif
+  applyNumaPolicy(ptr, byteSize_, numaBindNode, numaInterleaveMask);
   address_ = reinterpret_cast<uint8_t*>(ptr);
 }
 
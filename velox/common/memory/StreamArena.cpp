@@ -33,15 +33,22 @@ void StreamArena::newRange(int32_t bytes, ByteRange* range) {
       allocations_.push_back(std::make_unique<memory::MappedMemory::Allocation>(
           std::move(allocation_)));
     }
-    if (!mappedMemory_->allocate(
-            std::max(allocationQuantum_, numPages),
-            kVectorStreamOwner,
-            allocation_)) {
-      throw std::bad_alloc();
+    if (!freeAllocations_.empty()) {
+      // Reuse a slab retained by clear(). Any allocation serves: the
+      // range handed out may cover fewer pages than asked.
+      allocation_ = std::move(*freeAllocations_.back());
+      freeAllocations_.pop_back();
+    } else {
+      if (!mappedMemory_->allocate(
+              std::max(allocationQuantum_, numPages),
+              kVectorStreamOwner,
+              allocation_)) {
+        throw std::bad_alloc();
+      }
+      size_ += allocation_.byteSize();
     }
     currentRun_ = 0;
     currentPage_ = 0;
-    size_ += allocation_.byteSize();
   }
   auto run = allocation_.runAt(currentRun_);
   int32_t available = run.numPages() - currentPage_;
@@ -56,6 +63,20 @@ void StreamArena::newRange(int32_t bytes, ByteRange* range) {
   }
 }
 
+void StreamArena::clear() {
+  if (allocation_.numRuns()) {
+    allocations_.push_back(std::make_unique<memory::MappedMemory::Allocation>(
+        std::move(allocation_)));
+  }
+  for (auto& allocation : allocations_) {
+    freeAllocations_.push_back(std::move(allocation));
+  }
+  allocations_.clear();
+  currentRun_ = 0;
+  currentPage_ = 0;
+  tinyRanges_.clear();
+}
+
 void StreamArena::newTinyRange(int32_t bytes, ByteRange* range) {
   tinyRanges_.emplace_back();
   tinyRanges_.back().resize(bytes);
@@ -47,6 +47,12 @@ class StreamArena {
     return size_;
   }
 
+  // Returns all slabs to a reuse list and forgets the tiny ranges. The
+  // next newRange calls hand out the retained memory again, so an arena
+  // serializing a stream of batches stops going to MappedMemory between
+  // flushes. The memory stays held by and accounted to 'this'.
+  virtual void clear();
+
   memory::MappedMemory* mappedMemory() {
     return mappedMemory_.get();
   }
@@ -55,6 +61,10 @@ class StreamArena {
   std::shared_ptr<memory::MappedMemory> mappedMemory_;
   // All allocations.
   std::vector<std::unique_ptr<memory::MappedMemory::Allocation>> allocations_;
+  // Allocations retained by clear() for reuse before going to
+  // MappedMemory.
+  std::vector<std::unique_ptr<memory::MappedMemory::Allocation>>
+      freeAllocations_;
   // The allocation from which pages are given out. Moved to 'allocations_' when
   // used up.
   memory::MappedMemory::Allocation allocation_;
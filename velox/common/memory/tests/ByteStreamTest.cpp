@@ -88,3 +88,25 @@ TEST_F(ByteStreamTest, outputStream) {
   // We expect dropping the stream and the iobuf frees the backing memory.
   EXPECT_EQ(0, mmapAllocator_->numAllocated());
 }
+
+TEST_F(ByteStreamTest, arenaClearAndReuse) {
+  StreamArena arena(mmapAllocator_.get());
+  ByteRange range;
+  for (auto i = 0; i < 10; ++i) {
+    arena.newRange(MappedMemory::kPageSize, &range);
+    ASSERT_NE(nullptr, range.buffer);
+  }
+  const auto sizeAfterFill = arena.size();
+  const auto pagesAfterFill = mmapAllocator_->numAllocated();
+
+  // Clearing keeps the slabs; refilling hands them out again without
+  // new allocations.
+  arena.clear();
+  EXPECT_EQ(sizeAfterFill, arena.size());
+  for (auto i = 0; i < 10; ++i) {
+    arena.newRange(MappedMemory::kPageSize, &range);
+    ASSERT_NE(nullptr, range.buffer);
+  }
+  EXPECT_EQ(sizeAfterFill, arena.size());
+  EXPECT_EQ(pagesAfterFill, mmapAllocator_->numAllocated());
+}
@@ -158,6 +158,41 @@ TEST_F(HashStringAllocatorTest, multipart) {
   instance_->checkConsistency();
 }
 
+TEST_F(HashStringAllocatorTest, bumpAllocation) {
+  instance_->setBumpAllocation(true);
+  constexpr int32_t kNumSamples = 2'000;
+  std::vector<Multipart> data(kNumSamples);
+  for (auto count = 0; count < 3; ++count) {
+    for (auto i = 0; i < kNumSamples; ++i) {
+      if (data[i].start.header && folly::Random::rand32(rng_) % 10 > 7) {
+        checkAndFree(data[i]);
+        continue;
+      }
+      auto chars = randomString();
+      ByteStream stream(instance_.get(), false, false);
+      if (data[i].start.header) {
+        instance_->extendWrite(data[i].current, stream);
+      } else {
+        data[i].start = instance_->newWrite(stream, chars.size());
+        data[i].current = data[i].start;
+      }
+      stream.appendStringPiece(folly::StringPiece(chars.data(), chars.size()));
+      data[i].current = instance_->finishWrite(stream, 0);
+      data[i].reference.insert(
+          data[i].reference.end(), chars.begin(), chars.end());
+    }
+    instance_->checkConsistency();
+  }
+  for (auto i = 0; i < data.size(); ++i) {
+    if (data[i].start.header) {
+      checkAndFree(data[i]);
+    }
+  }
+  instance_->checkConsistency();
+  instance_->setBumpAllocation(false);
+  instance_->checkConsistency();
+}
+
 TEST_F(HashStringAllocatorTest, rewrite) {
   ByteStream stream(instance_.get());
   auto header = instance_->allocate(5);
@@ -784,6 +784,32 @@ VELOX_INSTANTIATE_TEST_SUITE_P(
     MappedMemoryTest,
     testing::Values(true, false));
 
+// Huge page backing is best effort, so this is a functional smoke test:
+// allocations from huge-page advised size classes and contiguous
+// mappings behave the same as with 4KB pages.
+TEST(MmapAllocatorHugePagesTest, allocations) {
+  MappedMemory::destroyTestOnly();
+  MmapAllocatorOptions options;
+  options.capacity = 64UL << 20;
+  options.useHugePages = true;
+  auto allocator = std::make_shared<MmapAllocator>(options);
+
+  MappedMemory::Allocation allocation(allocator.get());
+  ASSERT_TRUE(allocator->allocate(256, 0, allocation));
+  for (int32_t i = 0; i < allocation.numRuns(); ++i) {
+    auto run = allocation.runAt(i);
+    memset(run.data(), 1, run.numBytes());
+  }
+  allocator->free(allocation);
+
+  MappedMemory::ContiguousAllocation contiguous;
+  ASSERT_TRUE(allocator->allocateContiguous(1024, nullptr, contiguous));
+  memset(contiguous.data(), 1, contiguous.size());
+  allocator->freeContiguous(contiguous);
+  ASSERT_TRUE(allocator->checkConsistency());
+  MappedMemory::destroyTestOnly();
+}
+
 class MmapArenaTest : public testing::Test {
  public:
   // 32 MB arena space
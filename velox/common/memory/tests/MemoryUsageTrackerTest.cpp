@@ -315,3 +315,70 @@ TEST(MemoryUsageTrackerTest, maybeReserve) {
   // The child destruction won't release the reserved memory back to the parent.
   EXPECT_EQ(8 * kMB, parent->getCurrentUserBytes());
 }
+
+TEST(MemoryUsageTrackerTest, reclaimCallback) {
+  constexpr int64_t kMB = 1 << 20;
+  auto config = MemoryUsageConfigBuilder().maxUserMemory(10 * kMB).build();
+  auto tracker = MemoryUsageTracker::create(config);
+
+  tracker->update(8 * kMB);
+
+  // Tier 1 reclaimer sheds up to 6MB by freeing tracked memory. The
+  // tier 0 reclaimer has nothing to give back and runs first.
+  int32_t numTier0Calls = 0;
+  auto idTier0 = tracker->registerReclaimCallback(0, [&](int64_t /*target*/) {
+    ++numTier0Calls;
+    return 0;
+  });
+  int64_t reclaimable = 6 * kMB;
+  auto idTier1 = tracker->registerReclaimCallback(1, [&](int64_t target) {
+    const auto bytes = std::min(target, reclaimable);
+    reclaimable -= bytes;
+    tracker->update(-bytes);
+    return bytes;
+  });
+
+  // Would exceed the cap by 2MB; the reclaimers free just the deficit.
+  tracker->update(4 * kMB);
+  EXPECT_EQ(1, numTier0Calls);
+  EXPECT_EQ(10 * kMB, tracker->getCurrentUserBytes());
+  EXPECT_EQ(4 * kMB, reclaimable);
+
+  // The next overshoot drains the rest of the reclaimable memory.
+  tracker->update(4 * kMB);
+  EXPECT_EQ(10 * kMB, tracker->getCurrentUserBytes());
+  EXPECT_EQ(0, reclaimable);
+
+  // Nothing left to shed, the cap error surfaces.
+  EXPECT_THROW(tracker->update(4 * kMB), VeloxRuntimeError);
+  EXPECT_EQ(10 * kMB, tracker->getCurrentUserBytes());
+
+  tracker->unregisterReclaimCallback(idTier0);
+  tracker->unregisterReclaimCallback(idTier1);
+  EXPECT_THROW(tracker->update(4 * kMB), VeloxRuntimeError);
+}
+
+TEST(MemoryUsageTrackerTest, quantizedReservationLease) {
+  constexpr int64_t kMB = 1 << 20;
+  auto parent = MemoryUsageTracker::create();
+  auto child = parent->addChild();
+
+  // The first allocation leases a quantized reservation from the
+  // parent.
+  child->update(1);
+  EXPECT_EQ(kMB, parent->getCurrentUserBytes());
+
+  // Allocations within the lease do not touch the parent chain.
+  for (auto i = 0; i < 100; ++i) {
+    child->update(1000);
+  }
+  EXPECT_EQ(kMB, parent->getCurrentUserBytes());
+
+  // Exceeding the lease grows it by whole quanta.
+  child->update(kMB);
+  EXPECT_EQ(2 * kMB, parent->getCurrentUserBytes());
+
+  // Freeing everything returns the lease.
+  child->update(-(kMB + 100 * 1000 + 1));
+  EXPECT_EQ(0, parent->getCurrentUserBytes());
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/process/PerfCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace facebook::velox::process {
+
+#ifdef __linux__
+
+namespace {
+int openCounter(
+    uint32_t type,
+    uint64_t config,
+    int groupFd,
+    uint64_t* id) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = groupFd == -1 ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+  const int fd = static_cast<int>(
+      syscall(SYS_perf_event_open, &attr, 0 /*this thread*/, -1, groupFd, 0));
+  if (fd >= 0 && id != nullptr) {
+    ioctl(fd, PERF_EVENT_IOC_ID, id);
+  }
+  return fd;
+}
+} // namespace
+
+PerfCounterGroup::PerfCounterGroup() {
+  groupFd_ = openCounter(
+      PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1, &ids_[0]);
+  if (groupFd_ < 0) {
+    return;
+  }
+  // Best effort for the siblings: missing events read as zero.
+  siblingFds_[0] = openCounter(
+      PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, groupFd_, &ids_[1]);
+  siblingFds_[1] = openCounter(
+      PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, groupFd_, &ids_[2]);
+  siblingFds_[2] = openCounter(
+      PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, groupFd_, &ids_[3]);
+  ioctl(groupFd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(groupFd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+  for (const int fd : siblingFds_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  if (groupFd_ >= 0) {
+    close(groupFd_);
+  }
+}
+
+PerfCounterGroup::Values PerfCounterGroup::read() const {
+  Values values;
+  if (groupFd_ < 0) {
+    return values;
+  }
+  // PERF_FORMAT_GROUP layout: nr, then {value, id} per counter.
+  struct {
+    uint64_t nr;
+    struct {
+      uint64_t value;
+      uint64_t id;
+    } entries[8];
+  } buffer;
+  const auto bytes = ::read(groupFd_, &buffer, sizeof(buffer));
+  if (bytes < static_cast<ssize_t>(sizeof(uint64_t))) {
+    return values;
+  }
+  for (uint64_t i = 0; i < buffer.nr && i < 8; ++i) {
+    const auto id = buffer.entries[i].id;
+    const auto value = static_cast<int64_t>(buffer.entries[i].value);
+    if (id == ids_[0]) {
+      values.cycles = value;
+    } else if (id == ids_[1]) {
+      values.instructions = value;
+    } else if (id == ids_[2]) {
+      values.llcMisses = value;
+    } else if (id == ids_[3]) {
+      values.branchMisses = value;
+    }
+  }
+  return values;
+}
+
+#else // !__linux__
+
+PerfCounterGroup::PerfCounterGroup() {}
+
+PerfCounterGroup::~PerfCounterGroup() {}
+
+PerfCounterGroup::Values PerfCounterGroup::read() const {
+  return {};
+}
+
+#endif
+
+PerfCounterGroup& threadPerfCounters() {
+  thread_local PerfCounterGroup counters;
+  return counters;
+}
+
+} // namespace facebook::velox::process
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::velox::process {
+
+/// A group of hardware performance counters bound to the calling
+/// thread, read as deltas around code sections: cycles, instructions,
+/// last-level cache misses and branch misses. Linux perf_event based;
+/// on other platforms, or when the kernel denies perf_event_open
+/// (perf_event_paranoid, containers without CAP_PERFMON), the group is
+/// disabled and enabled() returns false.
+class PerfCounterGroup {
+ public:
+  struct Values {
+    int64_t cycles{0};
+    int64_t instructions{0};
+    int64_t llcMisses{0};
+    int64_t branchMisses{0};
+  };
+
+  PerfCounterGroup();
+  ~PerfCounterGroup();
+
+  PerfCounterGroup(const PerfCounterGroup&) = delete;
+  void operator=(const PerfCounterGroup&) = delete;
+
+  bool enabled() const {
+    return groupFd_ >= 0;
+  }
+
+  /// Returns the current counter values of this thread's group.
+  /// All-zero when disabled.
+  Values read() const;
+
+ private:
+  // Leader fd of the counter group, -1 when disabled, followed by the
+  // sibling fds.
+  int groupFd_{-1};
+  int siblingFds_[3]{-1, -1, -1};
+  uint64_t ids_[4]{};
+};
+
+/// The calling thread's counter group, opened on first use.
+PerfCounterGroup& threadPerfCounters();
+
+} // namespace facebook::velox::process
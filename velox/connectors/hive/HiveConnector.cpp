@@ -16,6 +16,7 @@
 
 #include "velox/connectors/hive/HiveConnector.h"
 
+#include "velox/common/file/FileSystems.h"
 #include "velox/dwio/common/InputStream.h"
 #include "velox/dwio/common/ReaderFactory.h"
 #include "velox/expression/FieldReference.h"
@@ -366,6 +367,11 @@ void HiveDataSource::addDynamicFilter(
     const std::shared_ptr<common::Filter>& filter) {
   auto& fieldSpec = scanSpec_->getChildByChannel(outputChannel);
   if (fieldSpec.filter()) {
+    if (filter->kind() == common::FilterKind::kBigintBloomFilter) {
+      // Bloom filters are advisory; keep the exact filter instead of
+      // merging, which the existing filter kinds do not support.
+      return;
+    }
     fieldSpec.setFilter(fieldSpec.filter()->mergeWith(filter.get()));
   } else {
     fieldSpec.setFilter(filter->clone());
@@ -383,6 +389,10 @@ void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   VLOG(1) << "Adding split " << split_->toString();
 
   fileHandle_ = fileHandleFactory_->generate(split_->filePath);
+  // Plan read coalescing for the storage tier behind this split: S3
+  // class stores merge multi-MB gaps, local NVMe only small ones.
+  readerOpts_.setFromIoProfile(
+      filesystems::getFileSystem(split_->filePath, nullptr)->ioProfile());
   // For DataCache and no cache, the stream keeps track of IO.
   auto asyncCache = dynamic_cast<cache::AsyncDataCache*>(mappedMemory_);
   // Decide between AsyncDataCache, legacy DataCache and no cache. All
@@ -616,6 +626,25 @@ void HiveDataSource::setPartitionValue(
 
 std::unordered_map<std::string, RuntimeCounter> HiveDataSource::runtimeStats() {
   auto res = runtimeStats_.toMap();
+  // Per-column read cost from the ScanSpec's selectivity tracking:
+  // cycles spent reading plus filtering each filtered column and the
+  // rows it saw and dropped, so table layout decisions can follow
+  // measured per-column costs.
+  if (scanSpec_ != nullptr) {
+    for (const auto& child : scanSpec_->children()) {
+      const auto& selectivity = child->selectivity();
+      if (selectivity.numIn() == 0) {
+        continue;
+      }
+      res.insert(
+          {{fmt::format("{}.filterClocks", child->fieldName()),
+            RuntimeCounter(selectivity.timeClocks())},
+           {fmt::format("{}.rowsIn", child->fieldName()),
+            RuntimeCounter(selectivity.numIn())},
+           {fmt::format("{}.rowsFiltered", child->fieldName()),
+            RuntimeCounter(selectivity.numIn() - selectivity.numOut())}});
+    }
+  }
   res.insert(
       {{"numPrefetch", RuntimeCounter(ioStats_->prefetch().count())},
        {"prefetchBytes",
@@ -24,6 +24,9 @@
 #include <memory>
 #include <stdexcept>
 
+#include <condition_variable>
+#include <mutex>
+
 #include <aws/core/Aws.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/http/HttpResponse.h>
@@ -139,9 +142,18 @@ class S3ReadFile final : public ReadFile {
   }
 
  private:
+  // Reads of at least this size split into parallel ranged GETs so one
+  // slow request only delays its own part.
+  static constexpr uint64_t kParallelReadThreshold = 16 << 20;
+  static constexpr uint64_t kPartSize = 8 << 20;
+
   // The assumption here is that "position" has space for at least "length"
   // bytes.
   void preadInternal(uint64_t offset, uint64_t length, char* position) const {
+    if (length >= kParallelReadThreshold) {
+      parallelRead(offset, length, position);
+      return;
+    }
     // Read the desired range of bytes.
     Aws::S3::Model::GetObjectRequest request;
     Aws::S3::Model::GetObjectResult result;
@@ -157,6 +169,58 @@ class S3ReadFile final : public ReadFile {
     VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to get S3 object", bucket_, key_);
   }
 
+  // Issues one ranged GET per kPartSize slice through the SDK's async
+  // client, writing each directly into its slice of 'position', and
+  // waits for all of them. The parts ride separate connections, so a
+  // single slow request bounds only its own 8MB.
+  void parallelRead(uint64_t offset, uint64_t length, char* position) const {
+    struct State {
+      std::mutex mutex;
+      std::condition_variable cv;
+      int32_t remaining;
+      std::string error;
+      bool failed{false};
+    };
+    const int32_t numParts = (length + kPartSize - 1) / kPartSize;
+    auto state = std::make_shared<State>();
+    state->remaining = numParts;
+
+    for (int32_t i = 0; i < numParts; ++i) {
+      const uint64_t partOffset = offset + i * kPartSize;
+      const uint64_t partLength =
+          std::min<uint64_t>(kPartSize, length - i * kPartSize);
+      Aws::S3::Model::GetObjectRequest request;
+      request.SetBucket(awsString(bucket_));
+      request.SetKey(awsString(key_));
+      std::stringstream ss;
+      ss << "bytes=" << partOffset << "-" << partOffset + partLength - 1;
+      request.SetRange(awsString(ss.str()));
+      request.SetResponseStreamFactory(
+          AwsWriteableStreamFactory(position + i * kPartSize, partLength));
+      client_->GetObjectAsync(
+          request,
+          [state](
+              const Aws::S3::S3Client*,
+              const Aws::S3::Model::GetObjectRequest&,
+              Aws::S3::Model::GetObjectOutcome outcome,
+              const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) {
+            std::lock_guard<std::mutex> l(state->mutex);
+            if (!outcome.IsSuccess() && !state->failed) {
+              state->failed = true;
+              state->error = outcome.GetError().GetMessage();
+            }
+            if (--state->remaining == 0) {
+              state->cv.notify_all();
+            }
+          });
+    }
+
+    std::unique_lock<std::mutex> l(state->mutex);
+    state->cv.wait(l, [&]() { return state->remaining == 0; });
+    VELOX_CHECK(
+        !state->failed, "Failed to get S3 object: {}: {}", key_, state->error);
+  }
+
   Aws::S3::S3Client* client_;
   std::string bucket_;
   std::string key_;
@@ -180,6 +244,12 @@ class S3Config {
     return config_->get("hive.s3.ssl.enabled", true);
   }
 
+  // Connection pool size of the S3 client, sized for high fan-out
+  // scans. The SDK default of 25 starves wide parallel reads.
+  int32_t maxConnections() const {
+    return config_->get<int32_t>("hive.s3.max-connections", 128);
+  }
+
   bool useInstanceCredentials() const {
     return config_->get("hive.s3.use-instance-credentials", false);
   }
@@ -306,6 +376,7 @@ class S3FileSystem::Impl {
     Aws::Client::ClientConfiguration clientConfig;
 
     clientConfig.endpointOverride = s3Config_.endpoint();
+    clientConfig.maxConnections = s3Config_.maxConnections();
 
     if (s3Config_.useSSL()) {
       clientConfig.scheme = Aws::Http::Scheme::HTTPS;
@@ -37,6 +37,13 @@ class S3FileSystem : public FileSystem {
 
   std::string name() const override;
 
+  /// Request count dominates on S3: a GET costs tens of milliseconds
+  /// while a stream sustains on the order of 100MB/s, so read planners
+  /// should merge multi-MB gaps.
+  IoProfile ioProfile() const override {
+    return {100LL << 20 /*100MB/s*/, 20'000 /*20ms*/};
+  }
+
   void remove(std::string_view path) override {
     VELOX_UNSUPPORTED("remove for S3 not implemented");
   }
@@ -580,6 +580,10 @@ void TopNNode::addDetails(std::stringstream& stream) const {
   addSortingKeys(stream, sortingKeys_, sortingOrders_);
 }
 
+void PrefetchNode::addDetails(std::stringstream& stream) const {
+  stream << numBatches_ << " batches";
+}
+
 void LimitNode::addDetails(std::stringstream& stream) const {
   if (isPartial_) {
     stream << "PARTIAL ";
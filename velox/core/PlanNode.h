@@ -743,11 +743,13 @@ class LocalPartitionNode : public PlanNode {
       const PlanNodeId& id,
       Type type,
       PartitionFunctionFactory partitionFunctionFactory,
-      std::vector<PlanNodePtr> sources)
+      std::vector<PlanNodePtr> sources,
+      bool mayRebalanceSkew = false)
       : PlanNode(id),
         type_{type},
         sources_{std::move(sources)},
-        partitionFunctionFactory_{std::move(partitionFunctionFactory)} {
+        partitionFunctionFactory_{std::move(partitionFunctionFactory)},
+        mayRebalanceSkew_{mayRebalanceSkew} {
     VELOX_CHECK_GT(
         sources_.size(),
         0,
@@ -790,6 +792,15 @@ class LocalPartitionNode : public PlanNode {
     return partitionFunctionFactory_;
   }
 
+  /// True if the consumer tolerates rows of one key landing in multiple
+  /// partitions, e.g. partial aggregation or stateless projections, so the
+  /// exchange may reroute rows of overloaded partitions at runtime to keep
+  /// all consumers busy under skew. Must be false when the consumer relies
+  /// on co-location of equal keys, e.g. final aggregation.
+  bool mayRebalanceSkew() const {
+    return mayRebalanceSkew_;
+  }
+
   std::string_view name() const override {
     return "LocalPartition";
   }
@@ -800,6 +811,7 @@ class LocalPartitionNode : public PlanNode {
   const Type type_;
   const std::vector<PlanNodePtr> sources_;
   const PartitionFunctionFactory partitionFunctionFactory_;
+  const bool mayRebalanceSkew_;
 };
 
 class PartitionedOutputNode : public PlanNode {
@@ -1073,7 +1085,8 @@ class HashJoinNode : public AbstractJoinNode {
       TypedExprPtr filter,
       PlanNodePtr left,
       PlanNodePtr right,
-      const RowTypePtr outputType)
+      const RowTypePtr outputType,
+      bool radixPartitionedBuild = false)
       : AbstractJoinNode(
             id,
             joinType,
@@ -1082,11 +1095,22 @@ class HashJoinNode : public AbstractJoinNode {
             filter,
             left,
             right,
-            outputType) {}
+            outputType),
+        radixPartitionedBuild_(radixPartitionedBuild) {}
 
   std::string_view name() const override {
     return "HashJoin";
   }
+
+  /// True if the build side is partitioned by a prefix of the hash and
+  /// the join table is built partition-parallel on the Task's executor
+  /// instead of merging per-driver tables on one thread.
+  bool isRadixPartitionedBuild() const {
+    return radixPartitionedBuild_;
+  }
+
+ private:
+  const bool radixPartitionedBuild_;
 };
 
 /// Represents inner/outer/semi/anti merge joins. Translates to an
@@ -1267,6 +1291,44 @@ class TopNNode : public PlanNode {
   const std::vector<PlanNodePtr> sources_;
 };
 
+/// Buffers batches produced by its source and loads their lazy columns
+/// on the Task's executor ahead of the consumer, so that scan I/O and
+/// decode overlap with downstream CPU. Translates to an exec::Prefetch
+/// operator. 'numBatches' bounds the number of batches buffered ahead.
+class PrefetchNode : public PlanNode {
+ public:
+  PrefetchNode(
+      const PlanNodeId& id,
+      int32_t numBatches,
+      const PlanNodePtr& source)
+      : PlanNode(id), numBatches_(numBatches), sources_{source} {
+    VELOX_CHECK_GT(
+        numBatches, 0, "Prefetch must buffer at least one batch ahead");
+  }
+
+  const RowTypePtr& outputType() const override {
+    return sources_[0]->outputType();
+  }
+
+  const std::vector<PlanNodePtr>& sources() const override {
+    return sources_;
+  }
+
+  int32_t numBatches() const {
+    return numBatches_;
+  }
+
+  std::string_view name() const override {
+    return "Prefetch";
+  }
+
+ private:
+  void addDetails(std::stringstream& stream) const override;
+
+  const int32_t numBatches_;
+  const std::vector<PlanNodePtr> sources_;
+};
+
 class LimitNode : public PlanNode {
  public:
   // @param isPartial Boolean indicating whether Limit node generates partial
@@ -85,6 +85,18 @@ class QueryConfig {
   static constexpr const char* kMaxExtendedPartialAggregationMemory =
       "max_extended_partial_aggregation_memory";
 
+  /// Minimum number of input rows seen before partial aggregation may be
+  /// abandoned for poor reduction.
+  static constexpr const char* kAbandonPartialAggregationMinRows =
+      "abandon_partial_aggregation_min_rows";
+
+  /// Output rows as a percentage of input rows at or above which a partial
+  /// aggregation that has seen at least the minimum number of rows is
+  /// abandoned: the operator stops growing its hash table and flushes every
+  /// batch, keeping memory bounded on high-cardinality keys.
+  static constexpr const char* kAbandonPartialAggregationMinPct =
+      "abandon_partial_aggregation_min_pct";
+
   /// Output volume as percentage of input volume below which we will not seek
   /// to increase reduction by using more memory. the data volume is measured as
   /// the number of rows.
@@ -99,6 +111,17 @@ class QueryConfig {
   static constexpr const char* kPreferredOutputBatchSize =
       "preferred_output_batch_size";
 
+  /// Preferred size in bytes of batches returned by operators from
+  /// Operator::getOutput when the operator can measure its output row
+  /// width. Overrides the row count above for such operators.
+  static constexpr const char* kPreferredOutputBatchBytes =
+      "preferred_output_batch_bytes";
+
+  /// Cap on the number of rows in a batch sized by
+  /// 'preferred_output_batch_bytes', so narrow rows do not produce
+  /// unboundedly large row counts.
+  static constexpr const char* kMaxOutputBatchRows = "max_output_batch_rows";
+
   static constexpr const char* kHashAdaptivityEnabled =
       "driver.hash_adaptivity_enabled";
 
@@ -107,6 +130,13 @@ class QueryConfig {
 
   static constexpr const char* kCreateEmptyFiles = "driver.create_empty_files";
 
+  /// If true, aggregations with only fixed-width accumulators keep the
+  /// accumulators in per-column contiguous arrays indexed by group id
+  /// instead of inline in the RowContainer row. Not used when the
+  /// aggregation may spill.
+  static constexpr const char* kColumnarAccumulatorsEnabled =
+      "columnar_accumulators_enabled";
+
   /// Global enable spilling flag.
   static constexpr const char* kSpillEnabled = "spill_enabled";
 
@@ -143,9 +173,70 @@ class QueryConfig {
   static constexpr const char* kSpillFileSizeFactor =
       "spiller-file-size-factor";
 
+  /// Codec for compressing spill files: "none", "zstd", "lz4" or
+  /// "snappy".
+  static constexpr const char* kSpillCompressionCodec =
+      "spill_compression_codec";
+
+  /// Codec for compressing exchange pages: "none", "lz4", "zstd" or
+  /// "snappy". Must be set identically on producing and consuming
+  /// tasks of a query.
+  static constexpr const char* kExchangeCompressionCodec =
+      "exchange_compression_codec";
+
+  /// If true, drivers record per-operator call spans and blocked
+  /// intervals, retrievable per Task as Chrome trace-event JSON.
+  /// Meant to be set on a sampled fraction of production queries.
+  static constexpr const char* kQueryTraceEnabled = "query_trace_enabled";
+
+  /// If true, drivers compact output string columns whose out-of-line
+  /// strings are scattered over many string buffers, e.g. after
+  /// multi-join pipelines, trading one linear copy for single-buffer
+  /// locality in downstream passes.
+  static constexpr const char* kCompactStringBuffers =
+      "compact_string_buffers";
+
+  /// Maximum continuous time in milliseconds a driver runs on a thread
+  /// before voluntarily yielding it at the next operator boundary, so
+  /// that tasks sharing an executor time-slice instead of one heavy
+  /// task starving the rest. Zero (the default) disables the slice.
+  static constexpr const char* kDriverCpuTimeSliceLimitMs =
+      "driver_cpu_time_slice_limit_ms";
+
+  /// If true, operator calls record hardware counter deltas (cycles,
+  /// instructions, LLC misses, branch misses) into runtime stats via
+  /// per-thread perf_event groups. Linux only; silently off where the
+  /// kernel denies perf_event_open.
+  static constexpr const char* kOperatorHwCountersEnabled =
+      "operator_hw_counters_enabled";
+
   static constexpr const char* kSpillableReservationGrowthPct =
       "spillable-reservation-growth-pct";
 
+  std::string spillCompressionCodec() const {
+    return get<std::string>(kSpillCompressionCodec, "none");
+  }
+
+  bool queryTraceEnabled() const {
+    return get<bool>(kQueryTraceEnabled, false);
+  }
+
+  bool operatorHwCountersEnabled() const {
+    return get<bool>(kOperatorHwCountersEnabled, false);
+  }
+
+  bool compactStringBuffers() const {
+    return get<bool>(kCompactStringBuffers, false);
+  }
+
+  uint32_t driverCpuTimeSliceLimitMs() const {
+    return get<uint32_t>(kDriverCpuTimeSliceLimitMs, 0);
+  }
+
+  std::string exchangeCompressionCodec() const {
+    return get<std::string>(kExchangeCompressionCodec, "none");
+  }
+
   uint64_t maxPartialAggregationMemoryUsage() const {
     static constexpr uint64_t kDefault = 1L << 24;
     return get<uint64_t>(kMaxPartialAggregationMemory, kDefault);
@@ -156,6 +247,14 @@ class QueryConfig {
     return get<uint64_t>(kMaxExtendedPartialAggregationMemory, kDefault);
   }
 
+  int64_t abandonPartialAggregationMinRows() const {
+    return get<int64_t>(kAbandonPartialAggregationMinRows, 100'000);
+  }
+
+  int32_t abandonPartialAggregationMinPct() const {
+    return get<int32_t>(kAbandonPartialAggregationMinPct, 80);
+  }
+
   uint64_t aggregationSpillMemoryThreshold() const {
     static constexpr uint64_t kDefault = 0;
     return get<uint64_t>(kAggregationSpillMemoryThreshold, kDefault);
@@ -189,6 +288,19 @@ class QueryConfig {
     return get<uint32_t>(kPreferredOutputBatchSize, 1024);
   }
 
+  /// Target size in bytes of an output batch for operators that measure
+  /// their output row width, see Operator::outputBatchRows(). The row
+  /// count is clamped to 'max_output_batch_rows'.
+  uint64_t preferredOutputBatchBytes() const {
+    static constexpr uint64_t kDefault = 10UL << 20;
+    return get<uint64_t>(kPreferredOutputBatchBytes, kDefault);
+  }
+
+  /// Max number of rows in an output batch regardless of row width.
+  uint32_t maxOutputBatchRows() const {
+    return get<uint32_t>(kMaxOutputBatchRows, 10'000);
+  }
+
   bool hashAdaptivityEnabled() const {
     return get<bool>(kHashAdaptivityEnabled, true);
   }
@@ -243,6 +355,10 @@ class QueryConfig {
     return get<bool>(kExprEvalSimplified, false);
   }
 
+  bool columnarAccumulatorsEnabled() const {
+    return get<bool>(kColumnarAccumulatorsEnabled, false);
+  }
+
   /// Returns true if spilling is enabled.
   bool spillEnabled() const {
     return get<bool>(kSpillEnabled, false);
@@ -254,6 +370,10 @@ class QueryConfig {
   /// composed of Task id and serial numbers. The files are automatically
   /// deleted when no longer needed. Files may be left behind after crashes but
   /// are identifiable based on the Task id in the name.
+  /// May be a comma separated list of directories, e.g. one per local
+  /// drive; concurrent spilling operators then stripe across the
+  /// entries. Each entry may use any registered file system scheme,
+  /// including remote ones.
   std::optional<std::string> spillPath() const {
     return get<std::string>(kSpillPath, "/tmp");
   }
@@ -116,6 +116,16 @@ class QueryCtx : public Context {
     return executor;
   }
 
+  /// True if an executor was supplied, i.e. executor() will not throw.
+  /// False in single-threaded execution via Task::next().
+  bool isExecutorSupplied() const {
+    if (executor_) {
+      return true;
+    }
+    auto executor = executorKeepalive_.get();
+    return executor != nullptr;
+  }
+
   const QueryConfig& config() const {
     return config_;
   }
@@ -19,6 +19,7 @@
 #include <limits>
 #include <unordered_set>
 
+#include "velox/common/file/FileSystems.h"
 #include "velox/common/memory/Memory.h"
 #include "velox/dwio/common/BufferedInput.h"
 #include "velox/dwio/common/ColumnSelector.h"
@@ -104,6 +105,8 @@ class RowReaderOptions {
   // operations.
   std::shared_ptr<folly::Executor> decodingExecutor_;
   std::shared_ptr<folly::Executor> ioExecutor_;
+  // Sorted file-relative row numbers to read, nullptr to read all rows.
+  std::shared_ptr<const std::vector<uint64_t>> rowNumbers_;
 
  public:
   RowReaderOptions(const RowReaderOptions& other) {
@@ -116,6 +119,7 @@ class RowReaderOptions {
     scanSpec_ = other.scanSpec_;
     returnFlatVector_ = other.returnFlatVector_;
     flatmapNodeIdAsStruct_ = other.flatmapNodeIdAsStruct_;
+    rowNumbers_ = other.rowNumbers_;
   }
 
   RowReaderOptions() noexcept
@@ -182,6 +186,18 @@ class RowReaderOptions {
         : std::numeric_limits<uint64_t>::max();
   }
 
+  /// Restricts reading to the given sorted file-relative row numbers,
+  /// for point lookup workloads. Only supported by the selective reader
+  /// path, which skips straight to the requested positions instead of
+  /// decoding whole stripes. nullptr (the default) reads all rows.
+  void setRowNumbers(std::shared_ptr<const std::vector<uint64_t>> rowNumbers) {
+    rowNumbers_ = std::move(rowNumbers);
+  }
+
+  const std::shared_ptr<const std::vector<uint64_t>>& getRowNumbers() const {
+    return rowNumbers_;
+  }
+
   /**
    * Request that stripes be pre-loaded.
    */
@@ -442,6 +458,24 @@ class ReaderOptions {
     return *this;
   }
 
+  /// Derives loadQuantum and maxCoalesceDistance from the IO cost
+  /// profile of the storage tier serving the reads. A gap is merged
+  /// when reading its bytes through costs less than another request's
+  /// fixed latency, so the coalesce distance is the bytes one request
+  /// latency is worth at the tier's bandwidth; the load quantum
+  /// amortizes the request cost to ~10% by covering ten times that.
+  /// On NVMe this yields small merge distances, on S3-class stores
+  /// multi-MB ones.
+  ReaderOptions& setFromIoProfile(const filesystems::IoProfile& profile) {
+    const int64_t latencyBytes = profile.bandwidthBytesPerSecond *
+        profile.requestLatencyUs / 1'000'000;
+    maxCoalesceDistance_ = std::min<int64_t>(
+        16 << 20, std::max<int64_t>(64 << 10, latencyBytes));
+    loadQuantum_ = std::min<int64_t>(
+        64 << 20, std::max<int64_t>(1 << 20, 10 * latencyBytes));
+    return *this;
+  }
+
   /**
    * Modify the serialization-deserialization options.
    */
@@ -54,6 +54,11 @@ class Decompressor {
     return blockSize_;
   }
 
+  /// Largest possible uncompressed block, from the stripe footer.
+  uint64_t blockSize() const {
+    return blockSize_;
+  }
+
   virtual uint64_t decompress(
       const char* src,
       uint64_t srcLength,
@@ -22,8 +22,15 @@ namespace facebook::velox::dwrf {
 
 void PagedInputStream::prepareOutputBuffer(uint64_t uncompressedLength) {
   if (!outputBuffer_ || uncompressedLength > outputBuffer_->capacity()) {
-    outputBuffer_ = std::make_unique<dwio::common::DataBuffer<char>>(
-        pool_, uncompressedLength);
+    // Size the scratch to the stream's compression block upfront: no
+    // block can exceed it, so the buffer is allocated once and reused
+    // for every block of the stream instead of growing block by block.
+    auto size = uncompressedLength;
+    if (decompressor_ != nullptr) {
+      size = std::max(size, decompressor_->blockSize());
+    }
+    outputBuffer_ =
+        std::make_unique<dwio::common::DataBuffer<char>>(pool_, size);
   }
 }
 
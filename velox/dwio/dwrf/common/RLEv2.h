@@ -23,6 +23,7 @@
 #include "velox/dwio/common/IntDecoder.h"
 #include "velox/dwio/common/exception/Exception.h"
 
+#include <cstring>
 #include <vector>
 
 namespace facebook::velox::dwrf {
@@ -115,7 +116,40 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
       const uint64_t* nulls = nullptr) {
     uint64_t ret = 0;
 
-    // TODO: unroll to improve performance
+    // Fast path: byte aligned start, no nulls and the whole run inside
+    // the current buffer. Each value is extracted from one big-endian
+    // 64-bit window instead of a per-bit loop, so the unpack cost is a
+    // load, a byte swap and two shifts per value.
+    if (!nulls && bitsLeft == 0 && fb >= 1 && fb <= 56 &&
+        dwio::common::IntDecoder<isSigned>::bufferStart) {
+      const uint64_t totalBits = len * fb;
+      const uint64_t numBytes = (totalBits + 7) / 8;
+      if (dwio::common::IntDecoder<isSigned>::bufferStart + numBytes + 8 <=
+          dwio::common::IntDecoder<isSigned>::bufferEnd) {
+        const auto* base = reinterpret_cast<const uint8_t*>(
+            dwio::common::IntDecoder<isSigned>::bufferStart);
+        uint64_t bitPos = 0;
+        for (uint64_t i = offset; i < offset + len; ++i) {
+          uint64_t word;
+          std::memcpy(&word, base + (bitPos >> 3), sizeof(word));
+          word = __builtin_bswap64(word);
+          data[i] =
+              static_cast<int64_t>((word << (bitPos & 7)) >> (64 - fb));
+          bitPos += fb;
+        }
+        dwio::common::IntDecoder<isSigned>::bufferStart += numBytes;
+        const uint32_t remainderBits = totalBits & 7;
+        if (remainderBits) {
+          // The last byte is partially consumed, keep its unread low
+          // bits like the bit-by-bit path does.
+          curByte = static_cast<uint32_t>(static_cast<uint8_t>(
+              *(dwio::common::IntDecoder<isSigned>::bufferStart - 1)));
+          bitsLeft = 8 - remainderBits;
+        }
+        return len;
+      }
+    }
+
     for (uint64_t i = offset; i < (offset + len); i++) {
       // skip null positions
       if (nulls && bits::isBitNull(nulls, i)) {
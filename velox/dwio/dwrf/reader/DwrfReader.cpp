@@ -233,6 +233,23 @@ void DwrfRowReader::checkSkipStrides(
   }
 }
 
+namespace {
+// Loads all lazy vectors in 'vector' recursively. Used when the reader
+// seeks past the produced rows right away, which would invalidate the
+// lazy loaders.
+void loadAllLazies(VectorPtr& vector) {
+  if (!vector) {
+    return;
+  }
+  vector = BaseVector::loadedVectorShared(vector);
+  if (auto* rowVector = vector->as<RowVector>()) {
+    for (auto& child : rowVector->children()) {
+      loadAllLazies(child);
+    }
+  }
+}
+} // namespace
+
 uint64_t DwrfRowReader::next(uint64_t size, VectorPtr& result) {
   DWIO_ENSURE_GT(size, 0);
   auto& footer = getReader().getFooter();
@@ -262,6 +279,7 @@ uint64_t DwrfRowReader::next(uint64_t size, VectorPtr& result) {
     uint64_t rowsToRead = std::min(
         static_cast<uint64_t>(size), rowsInCurrentStripe - currentRowInStripe);
 
+    bool skippedWindow = false;
     if (rowsToRead > 0) {
       // don't allow read to cross stride
       if (LIKELY(strideSize > 0)) {
@@ -274,8 +292,16 @@ uint64_t DwrfRowReader::next(uint64_t size, VectorPtr& result) {
       setStrideIndex(strideSize > 0 ? currentRowInStripe / strideSize : 0);
 
       if (selectiveColumnReader_) {
-        selectiveColumnReader_->next(rowsToRead, result);
+        const auto& rowNumbers = options_.getRowNumbers();
+        if (rowNumbers) {
+          skippedWindow = !readRequestedRows(*rowNumbers, rowsToRead, result);
+        } else {
+          selectiveColumnReader_->next(rowsToRead, result);
+        }
       } else {
+        DWIO_ENSURE(
+            !options_.getRowNumbers(),
+            "Row number pushdown requires the selective reader path");
         columnReader_->next(rowsToRead, result);
       }
     }
@@ -289,12 +315,54 @@ uint64_t DwrfRowReader::next(uint64_t size, VectorPtr& result) {
       newStripeLoaded = false;
     }
 
-    if (rowsToRead > 0) {
+    if (rowsToRead > 0 && !skippedWindow) {
       return rowsToRead;
     }
   }
 }
 
+bool DwrfRowReader::readRequestedRows(
+    const std::vector<uint64_t>& rowNumbers,
+    uint64_t rowsToRead,
+    VectorPtr& result) {
+  // Translate the requested file-relative row numbers falling into the
+  // current window into positions relative to the reader's offset.
+  const uint64_t windowStart =
+      firstRowOfStripe[currentStripe] + currentRowInStripe;
+  auto begin =
+      std::lower_bound(rowNumbers.begin(), rowNumbers.end(), windowStart);
+  auto end = std::lower_bound(begin, rowNumbers.end(), windowStart + rowsToRead);
+  const auto readOffset = selectiveColumnReader_->readOffset();
+  if (begin == end) {
+    // Nothing requested in this window, skip it without decoding.
+    selectiveColumnReader_->seekTo(readOffset + rowsToRead, false);
+    return false;
+  }
+  requestedRowsScratch_.clear();
+  requestedRowsScratch_.reserve(end - begin);
+  for (auto it = begin; it != end; ++it) {
+    // Selective readers expect strictly increasing rows, drop
+    // duplicates.
+    if (it != begin && *it == *(it - 1)) {
+      continue;
+    }
+    requestedRowsScratch_.push_back(*it - windowStart);
+  }
+  selectiveColumnReader_->read(
+      readOffset,
+      RowSet(requestedRowsScratch_.data(), requestedRowsScratch_.size()),
+      nullptr);
+  selectiveColumnReader_->getValues(
+      selectiveColumnReader_->outputRows(), &result);
+  // The realigning seek below invalidates lazy loaders, materialize
+  // everything first.
+  loadAllLazies(result);
+  // A subset read advances only to the last requested row; realign to
+  // the end of the window.
+  selectiveColumnReader_->seekTo(readOffset + rowsToRead, false);
+  return true;
+}
+
 void DwrfRowReader::resetFilterCaches() {
   if (selectiveColumnReader_) {
     selectiveColumnReader_->resetFilterCaches();
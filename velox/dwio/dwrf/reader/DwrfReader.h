@@ -133,8 +133,22 @@ class DwrfRowReader : public StrideIndexProvider,
   // next stride instead of next stripe.
   bool recomputeStridesToSkip_{false};
 
+  // Scratch for translating pushed down row numbers to positions
+  // relative to the read offset.
+  std::vector<vector_size_t> requestedRowsScratch_;
+
   // internal methods
 
+  // Reads the rows of the current window of 'rowsToRead' rows that are
+  // in 'rowNumbers' (sorted, file-relative), skipping the rest while
+  // decoding, and leaves the reader at the end of the window. Returns
+  // false if the window contains no requested rows, in which case it
+  // is skipped without producing output.
+  bool readRequestedRows(
+      const std::vector<uint64_t>& rowNumbers,
+      uint64_t rowsToRead,
+      VectorPtr& result);
+
   // Creates column reader tree and may start prefetch of frequently read
   // columns.
   void startNextStripe();
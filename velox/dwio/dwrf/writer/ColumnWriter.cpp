@@ -214,6 +214,8 @@ class IntegerColumnWriter : public BaseColumnWriter {
     DWIO_ENSURE_GE(dictionaryKeySizeThreshold_, 0.0);
     DWIO_ENSURE_LE(dictionaryKeySizeThreshold_, 1.0);
     DWIO_ENSURE(firstStripe_);
+    dictionaryEncodingInterval_ =
+        getConfig(Config::DICTIONARY_ENCODING_INTERVAL);
     if (!useDictionaryEncoding_) {
       // Suppress the stream used to initialize dictionary encoder.
       // TODO: passing factory method into the dict encoder also works
@@ -301,6 +303,15 @@ class IntegerColumnWriter : public BaseColumnWriter {
     indexBuilder_->addEntry(*indexStatsBuilder_);
     indexStatsBuilder_->reset();
     BaseColumnWriter::recordPosition();
+    // Evaluate the dictionary's efficiency on the rows sampled so far
+    // every DICTIONARY_ENCODING_INTERVAL strides, abandoning a losing
+    // dictionary early instead of buffering the whole stripe before
+    // deciding.
+    if (useDictionaryEncoding_ && dictionaryEncodingInterval_ > 0 &&
+        ++stridesSinceEncodingCheck_ >= dictionaryEncodingInterval_) {
+      stridesSinceEncodingCheck_ = 0;
+      tryAbandonDictionaries(false);
+    }
     // TODO: the only way useDictionaryEncoding_ right now is
     // through abandonDictionary, so we already have the stream initialization
     // handled. Might want to rethink stream initialization in the future when
@@ -466,6 +477,11 @@ class IntegerColumnWriter : public BaseColumnWriter {
   bool useDictionaryEncoding_;
   bool firstStripe_{true};
   DataBuffer<size_t> strideOffsets_;
+
+  // Strides between early dictionary efficiency evaluations, 0 turns
+  // the periodic check off.
+  uint32_t dictionaryEncodingInterval_{0};
+  uint32_t stridesSinceEncodingCheck_{0};
 };
 
 template <typename T>
@@ -805,6 +821,8 @@ class StringColumnWriter : public BaseColumnWriter {
         useDictionaryEncoding_{useDictionaryEncoding()},
         strideOffsets_{getMemoryPool(MemoryUsageCategory::GENERAL)} {
     DWIO_ENSURE(firstStripe_);
+    dictionaryEncodingInterval_ =
+        getConfig(Config::DICTIONARY_ENCODING_INTERVAL);
     if (!useDictionaryEncoding_) {
       initStreamWriters(useDictionaryEncoding_);
     }
@@ -893,6 +911,15 @@ class StringColumnWriter : public BaseColumnWriter {
     indexBuilder_->addEntry(*indexStatsBuilder_);
     indexStatsBuilder_->reset();
     BaseColumnWriter::recordPosition();
+    // Evaluate the dictionary's efficiency on the rows sampled so far
+    // every DICTIONARY_ENCODING_INTERVAL strides, abandoning a losing
+    // dictionary early instead of buffering the whole stripe before
+    // deciding.
+    if (useDictionaryEncoding_ && dictionaryEncodingInterval_ > 0 &&
+        ++stridesSinceEncodingCheck_ >= dictionaryEncodingInterval_) {
+      stridesSinceEncodingCheck_ = 0;
+      tryAbandonDictionaries(false);
+    }
     // TODO: the only way useDictionaryEncoding_ right now is
     // through abandonDictionary, so we already have the stream initialization
     // handled. Might want to rethink stream initialization in the future when
@@ -1078,6 +1105,11 @@ class StringColumnWriter : public BaseColumnWriter {
   bool useDictionaryEncoding_;
   bool firstStripe_{true};
   DataBuffer<size_t> strideOffsets_;
+
+  // Strides between early dictionary efficiency evaluations, 0 turns
+  // the periodic check off.
+  uint32_t dictionaryEncodingInterval_{0};
+  uint32_t stridesSinceEncodingCheck_{0};
 };
 
 uint64_t StringColumnWriter::write(
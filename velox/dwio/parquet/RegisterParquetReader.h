@@ -20,8 +20,12 @@ namespace facebook::velox::parquet {
 
 enum class ParquetReaderType { DUCKDB, NATIVE };
 
+/// Registers the Parquet reader factory. The native
+/// SelectiveColumnReader based reader is the default; the DuckDB
+/// wrapper remains available for types the native reader does not
+/// cover yet.
 void registerParquetReaderFactory(
-    ParquetReaderType parquetReaderType = ParquetReaderType::DUCKDB);
+    ParquetReaderType parquetReaderType = ParquetReaderType::NATIVE);
 
 void unregisterParquetReaderFactory();
 
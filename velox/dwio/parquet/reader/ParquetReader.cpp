@@ -441,7 +441,9 @@ void ReaderBase::scheduleRowGroups(
     newInput->load(dwio::common::LogType::STRIPE);
     inputs_[thisGroup] = std::move(newInput);
   }
-  if (nextGroup) {
+  if (nextGroup && !inputs_.count(nextGroup)) {
+    // Start the next group's IO while this group decodes, unless a
+    // prefetch is already in flight.
     auto newInput =
         bufferedInputFactory_->create(*stream_, pool_, options_.getFileNum());
     reader.enqueueRowGroup(nextGroup, *newInput);
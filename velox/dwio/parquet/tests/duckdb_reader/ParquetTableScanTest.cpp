@@ -35,7 +35,7 @@ class ParquetTableScanTest : public HiveConnectorTestBase {
 
   void SetUp() override {
     HiveConnectorTestBase::SetUp();
-    registerParquetReaderFactory();
+    registerParquetReaderFactory(ParquetReaderType::DUCKDB);
   }
 
   void TearDown() override {
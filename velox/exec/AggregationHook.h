@@ -35,6 +35,7 @@ class AggregationHook : public ValueHook {
   static constexpr Kind kFloatMin = 8;
   static constexpr Kind kDoubleMax = 9;
   static constexpr Kind kDoubleMin = 10;
+  static constexpr Kind kCount = 11;
 
   // Make null behavior known at compile time. This is useful when
   // templating a column decoding loop with a hook.
@@ -176,6 +177,30 @@ class SimpleCallableHook final : public AggregationHook {
   UpdateSingleValue updateSingleValue_;
 };
 
+// Counts the non-null values the reader produces for each group.
+// Values are skipped over nulls by the hook contract (kSkipNulls), so
+// this implements count(x) without materializing the column.
+class CountHook final : public AggregationHook {
+ public:
+  CountHook(
+      int32_t offset,
+      int32_t nullByte,
+      uint8_t nullMask,
+      char** groups,
+      uint64_t* numNulls)
+      : AggregationHook(offset, nullByte, nullMask, groups, numNulls) {}
+
+  Kind kind() const override {
+    return kCount;
+  }
+
+  void addValue(vector_size_t row, const void* /*value*/) override {
+    auto group = findGroup(row);
+    clearNull(group);
+    ++*reinterpret_cast<int64_t*>(group + offset_);
+  }
+};
+
 template <typename T, bool isMin>
 class MinMaxHook final : public AggregationHook {
  public:
@@ -88,20 +88,30 @@ void AssignUniqueId::generateIdColumn(vector_size_t size) {
       requestRowIds();
     }
 
-    auto batchSize =
-        std::min(maxRowIdCounterValue_ - rowIdCounter_ + 1, kRowIdsPerRequest);
-    auto end = (int32_t)std::min((int64_t)size, start + batchSize);
-    VELOX_CHECK_EQ((rowIdCounter_ + end - 1) & uniqueValueMask_, 0);
+    // 'maxRowIdCounterValue_' is exclusive: it is the first ID of the next
+    // block leased from 'rowIdPool_', possibly by another driver, and must
+    // never be emitted here.
+    auto available = maxRowIdCounterValue_ - rowIdCounter_;
+    auto end = (int32_t)std::min((int64_t)size, start + available);
+    VELOX_CHECK_EQ(
+        (rowIdCounter_ + (end - start) - 1) & uniqueValueMask_, 0);
     std::iota(
         rawResults + start, rawResults + end, uniqueValueMask_ | rowIdCounter_);
-    rowIdCounter_ += end;
+    rowIdCounter_ += end - start;
     start = end;
   }
 }
 
 void AssignUniqueId::requestRowIds() {
-  rowIdCounter_ = rowIdPool_->fetch_add(kRowIdsPerRequest);
+  rowIdCounter_ = rowIdPool_->fetch_add(rowIdsPerRequest_);
+  VELOX_CHECK_LT(
+      rowIdCounter_, kMaxRowId, "Ran out of unique IDs: exceeded 2^40 rows");
   maxRowIdCounterValue_ =
-      std::min(rowIdCounter_ + kRowIdsPerRequest, kMaxRowId);
+      std::min(rowIdCounter_ + rowIdsPerRequest_, kMaxRowId);
+  // Lease geometrically larger blocks as the driver proves it consumes them.
+  // Sustained ingestion converges to one pool access per kMaxRowIdsPerRequest
+  // rows while short-lived drivers do not strand large slices of the 2^40 ID
+  // space.
+  rowIdsPerRequest_ = std::min(rowIdsPerRequest_ * 2, kMaxRowIdsPerRequest);
 }
 } // namespace facebook::velox::exec
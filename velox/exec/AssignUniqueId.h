@@ -55,7 +55,8 @@ class AssignUniqueId : public Operator {
 
   void requestRowIds();
 
-  const int64_t kRowIdsPerRequest = 1L << 20;
+  const int64_t kInitialRowIdsPerRequest = 1L << 12;
+  const int64_t kMaxRowIdsPerRequest = 1L << 20;
   const int64_t kMaxRowId = 1L << 40;
   const int64_t kTaskUniqueIdLimit = 1L << 24;
 
@@ -63,6 +64,11 @@ class AssignUniqueId : public Operator {
   int64_t rowIdCounter_;
   int64_t maxRowIdCounterValue_;
 
+  // Number of IDs to lease from 'rowIdPool_' on the next request. Starts at
+  // kInitialRowIdsPerRequest and doubles on every request up to
+  // kMaxRowIdsPerRequest.
+  int64_t rowIdsPerRequest_ = kInitialRowIdsPerRequest;
+
   std::shared_ptr<std::atomic_int64_t> rowIdPool_;
 };
 } // namespace facebook::velox::exec
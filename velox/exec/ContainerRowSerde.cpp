@@ -126,6 +126,46 @@ void writeNulls(
   }
 }
 
+template <>
+void serializeOne<TypeKind::ARRAY>(
+    const BaseVector& source,
+    vector_size_t index,
+    ByteStream& out);
+
+template <>
+void serializeOne<TypeKind::MAP>(
+    const BaseVector& vector,
+    vector_size_t index,
+    ByteStream& out);
+
+// Serializes the non-null elements of [offset, offset + size) with the
+// element type resolved once instead of re-entering the TypeKind
+// dispatch per element.
+template <TypeKind Kind>
+void serializeRange(
+    const BaseVector& elements,
+    vector_size_t offset,
+    vector_size_t size,
+    ByteStream& out) {
+  for (auto i = 0; i < size; ++i) {
+    if (!elements.isNullAt(i + offset)) {
+      serializeOne<Kind>(elements, i + offset, out);
+    }
+  }
+}
+
+template <TypeKind Kind>
+void serializeRange(
+    const BaseVector& elements,
+    folly::Range<const vector_size_t*> indices,
+    ByteStream& out) {
+  for (auto i : indices) {
+    if (!elements.isNullAt(i)) {
+      serializeOne<Kind>(elements, i, out);
+    }
+  }
+}
+
 void serializeArray(
     BaseVector& elements,
     vector_size_t offset,
@@ -133,11 +173,12 @@ void serializeArray(
     ByteStream& out) {
   out.appendOne<int32_t>(size);
   writeNulls(elements, offset, size, out);
-  for (auto i = 0; i < size; ++i) {
-    if (!elements.isNullAt(i + offset)) {
-      serializeSwitch(elements, i + offset, out);
-    }
+  if (elements.typeKind() == TypeKind::UNKNOWN) {
+    // All values of UNKNOWN type are null; nothing is stored for them.
+    return;
   }
+  VELOX_DYNAMIC_TYPE_DISPATCH(
+      serializeRange, elements.typeKind(), elements, offset, size, out);
 }
 
 void serializeArray(
@@ -146,11 +187,12 @@ void serializeArray(
     ByteStream& out) {
   out.appendOne<int32_t>(indices.size());
   writeNulls(elements, indices, out);
-  for (auto i : indices) {
-    if (!elements.isNullAt(i)) {
-      serializeSwitch(elements, i, out);
-    }
+  if (elements.typeKind() == TypeKind::UNKNOWN) {
+    // All values of UNKNOWN type are null; nothing is stored for them.
+    return;
   }
+  VELOX_DYNAMIC_TYPE_DISPATCH(
+      serializeRange, elements.typeKind(), elements, indices, out);
 }
 
 template <>
@@ -267,6 +309,37 @@ void deserializeOne<TypeKind::ROW>(
   }
 }
 
+template <>
+void deserializeOne<TypeKind::ARRAY>(
+    ByteStream& in,
+    vector_size_t index,
+    BaseVector& result);
+
+template <>
+void deserializeOne<TypeKind::MAP>(
+    ByteStream& in,
+    vector_size_t index,
+    BaseVector& result);
+
+// Deserializes 'size' elements into [offset, offset + size) with the
+// element type resolved once instead of re-entering the TypeKind
+// dispatch per element.
+template <TypeKind Kind>
+void deserializeRange(
+    ByteStream& in,
+    vector_size_t offset,
+    vector_size_t size,
+    const uint64_t* nulls,
+    BaseVector& result) {
+  for (auto i = 0; i < size; ++i) {
+    if (bits::isBitSet(nulls, i)) {
+      result.setNull(i + offset, true);
+    } else {
+      deserializeOne<Kind>(in, i + offset, result);
+    }
+  }
+}
+
 // Reads the size, null flags and deserializes from 'in', appending to
 // the end of 'elements'. Returns the number of added elements and
 // sets 'offset' to the index of the first added element.
@@ -276,13 +349,22 @@ deserializeArray(ByteStream& in, BaseVector& elements, vector_size_t& offset) {
   auto nulls = readNulls(in, size);
   offset = elements.size();
   elements.resize(offset + size);
-  for (auto i = 0; i < size; ++i) {
-    if (bits::isBitSet(nulls.data(), i)) {
+  if (elements.typeKind() == TypeKind::UNKNOWN) {
+    // All values of UNKNOWN type are null; nothing was stored for them.
+    for (auto i = 0; i < size; ++i) {
+      VELOX_CHECK(bits::isBitSet(nulls.data(), i));
       elements.setNull(i + offset, true);
-    } else {
-      deserializeSwitch(in, i + offset, elements);
     }
+    return size;
   }
+  VELOX_DYNAMIC_TYPE_DISPATCH(
+      deserializeRange,
+      elements.typeKind(),
+      in,
+      offset,
+      size,
+      nulls.data(),
+      elements);
   return size;
 }
 
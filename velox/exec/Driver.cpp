@@ -19,12 +19,32 @@
 #include <folly/executors/task_queue/UnboundedBlockingQueue.h>
 #include <folly/executors/thread_factory/InitThreadFactory.h>
 #include <gflags/gflags.h>
+#include "velox/common/process/PerfCounters.h"
 #include "velox/common/time/Timer.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/Task.h"
+#include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
 
+namespace {
+// Terminate flag of the Task whose Driver is running on this thread,
+// nullptr when none. Polled by checkRunningDriverCancelled().
+thread_local const std::atomic<bool>* threadCancelledFlag = nullptr;
+} // namespace
+
+void setThreadCancelledFlag(const std::atomic<bool>* flag) {
+  threadCancelledFlag = flag;
+}
+
+void checkRunningDriverCancelled() {
+  const auto* flag = threadCancelledFlag;
+  if (FOLLY_UNLIKELY(
+          flag != nullptr && flag->load(std::memory_order_relaxed))) {
+    VELOX_FAIL("Cancelled: task terminated while the kernel was running");
+  }
+}
+
 DriverCtx::DriverCtx(
     std::shared_ptr<Task> _task,
     int _driverId,
@@ -161,8 +181,111 @@ Driver::Driver(
   // Operators need access to their Driver for adaptation.
   ctx_->driver = this;
   trackOperatorCpuUsage_ = ctx_->queryConfig().operatorTrackCpuUsage();
+  traceEnabled_ = ctx_->queryConfig().queryTraceEnabled();
+  compactStringsEnabled_ = ctx_->queryConfig().compactStringBuffers();
+  // The CPU slice re-enqueues on the executor; in single-threaded
+  // execution via Task::next() there is nothing to yield to.
+  cpuSliceLimitMs_ = ctx_->task->queryCtx()->isExecutorSupplied()
+      ? ctx_->queryConfig().driverCpuTimeSliceLimitMs()
+      : 0;
+  hwCountersEnabled_ = ctx_->queryConfig().operatorHwCountersEnabled();
 }
 
+namespace {
+// A flat string column fragmented over at least this many string
+// buffers gets compacted into one when compaction is enabled.
+constexpr size_t kCompactMinStringBuffers = 8;
+
+// Rewrites the out-of-line strings of 'result's fragmented top-level
+// string columns contiguously into one buffer each. See
+// QueryConfig::kCompactStringBuffers.
+void compactResultStrings(const RowVectorPtr& result) {
+  for (auto& child : result->children()) {
+    if (child->encoding() != VectorEncoding::Simple::FLAT) {
+      continue;
+    }
+    const auto kind = child->typeKind();
+    if (kind != TypeKind::VARCHAR && kind != TypeKind::VARBINARY) {
+      continue;
+    }
+    auto* flat = child->asUnchecked<FlatVector<StringView>>();
+    if (flat->stringBuffers().size() >= kCompactMinStringBuffers) {
+      flat->compactStringBuffers();
+    }
+  }
+}
+
+// RAII recording hardware counter deltas of one operator call into its
+// runtime stats.
+struct HwCounterProbe {
+  Operator* op;
+  process::PerfCounterGroup::Values start;
+  bool active;
+
+  HwCounterProbe(Driver* driver, Operator* _op)
+      : op(_op),
+        active(
+            driver->hwCountersEnabled() &&
+            process::threadPerfCounters().enabled()) {
+    if (active) {
+      start = process::threadPerfCounters().read();
+    }
+  }
+
+  ~HwCounterProbe() {
+    if (!active) {
+      return;
+    }
+    try {
+      const auto end = process::threadPerfCounters().read();
+      auto& stats = op->stats();
+      stats.addRuntimeStat(
+          "hwCycles", RuntimeCounter(end.cycles - start.cycles));
+      stats.addRuntimeStat(
+          "hwInstructions",
+          RuntimeCounter(end.instructions - start.instructions));
+      stats.addRuntimeStat(
+          "hwLlcMisses", RuntimeCounter(end.llcMisses - start.llcMisses));
+      stats.addRuntimeStat(
+          "hwBranchMisses",
+          RuntimeCounter(end.branchMisses - start.branchMisses));
+    } catch (...) {
+    }
+  }
+};
+
+// RAII recording one operator call span into the Driver's trace.
+struct DriverTraceSpan {
+  Driver* driver;
+  Operator* op;
+  const char* call;
+  int64_t startUs;
+
+  DriverTraceSpan(Driver* _driver, Operator* _op, const char* _call)
+      : driver(_driver),
+        op(_op),
+        call(_call),
+        startUs(driver->traceEnabled() ? getCurrentTimeMicro() : 0) {}
+
+  ~DriverTraceSpan() {
+    if (!driver->traceEnabled()) {
+      return;
+    }
+    // May run during exception unwind; recording must not throw.
+    try {
+      driver->addTraceEvent(Driver::TraceEvent{
+          fmt::format(
+              "{}.{}.{}", op->stats().operatorType, op->planNodeId(), call),
+          startUs,
+          getCurrentTimeMicro() - startUs,
+          driver->driverCtx()->pipelineId,
+          driver->driverCtx()->driverId});
+    } catch (...) {
+    }
+  }
+};
+} // namespace
+
 namespace {
 /// Checks if output channel is produced using identity projection and returns
 /// input channel if so.
@@ -284,6 +407,19 @@ StopReason Driver::runInternal(
         "queuedWallNanos",
         RuntimeCounter(queuedTime, RuntimeCounter::Unit::kNanos));
   }
+  if (traceEnabled_ && blockingReason_ != BlockingReason::kNotBlocked) {
+    // The interval between going off thread and resuming, attributed
+    // to the last blocking reason. Reset the reason so a later yield
+    // does not repeat it.
+    const int64_t durationUs = queuedTime / 1'000;
+    addTraceEvent(TraceEvent{
+        blockingReasonToString(blockingReason_),
+        getCurrentTimeMicro() - durationUs,
+        durationUs,
+        ctx_->pipelineId,
+        ctx_->driverId});
+    blockingReason_ = BlockingReason::kNotBlocked;
+  }
 
   CancelGuard guard(task().get(), &state_, [&](StopReason reason) {
     // This is run on error or cancel exit.
@@ -306,6 +442,17 @@ StopReason Driver::runInternal(
   const auto statWriterGuard =
       folly::makeGuard([]() { setRunTimeStatWriter(nullptr); });
 
+  // Let long-running kernels poll for termination while this driver is
+  // on thread.
+  setThreadCancelledFlag(&task()->terminateRequestedFlag());
+  const auto cancelFlagGuard =
+      folly::makeGuard([]() { setThreadCancelledFlag(nullptr); });
+
+  // Start of this continuous run on the thread, for the optional CPU
+  // time slice. Checked at operator boundaries only, so a single long
+  // operator call can still overrun the slice.
+  const uint64_t sliceStartMs = cpuSliceLimitMs_ ? getCurrentTimeMs() : 0;
+
   try {
     int32_t numOperators = operators_.size();
     ContinueFuture future;
@@ -318,6 +465,14 @@ StopReason Driver::runInternal(
           return stop;
         }
 
+        if (cpuSliceLimitMs_ &&
+            getCurrentTimeMs() - sliceStartMs >= cpuSliceLimitMs_) {
+          // CPU slice used up: yield the thread to other tasks' drivers
+          // by re-enqueueing at the back of the executor queue.
+          guard.notThrown();
+          return StopReason::kYield;
+        }
+
         auto op = operators_[i].get();
         // In case we are blocked, this index will point to the operator, whose
         // queuedTime we should update.
@@ -349,6 +504,8 @@ StopReason Driver::runInternal(
             RowVectorPtr result;
             {
               auto timer = cpuWallTimer(op->stats().getOutputTiming);
+              DriverTraceSpan trace(this, op, "getOutput");
+              HwCounterProbe hwProbe(this, op);
               result = op->getOutput();
               if (result) {
                 VELOX_CHECK(
@@ -359,11 +516,16 @@ StopReason Driver::runInternal(
                 op->stats().outputPositions += result->size();
                 resultBytes = result->estimateFlatSize();
                 op->stats().outputBytes += resultBytes;
+                if (compactStringsEnabled_) {
+                  compactResultStrings(result);
+                }
               }
             }
             pushdownFilters(i);
             if (result) {
               auto timer = cpuWallTimer(op->stats().addInputTiming);
+              DriverTraceSpan trace(this, nextOp, "addInput");
+              HwCounterProbe hwProbe(this, nextOp);
               nextOp->stats().inputVectors += 1;
               nextOp->stats().inputPositions += result->size();
               nextOp->stats().inputBytes += resultBytes;
@@ -393,6 +555,7 @@ StopReason Driver::runInternal(
               }
               if (op->isFinished()) {
                 auto timer = cpuWallTimer(op->stats().finishTiming);
+                DriverTraceSpan trace(this, nextOp, "noMoreInput");
                 nextOp->noMoreInput();
                 break;
               }
@@ -405,12 +568,17 @@ StopReason Driver::runInternal(
           // will come back here after this is again on thread.
           {
             auto timer = cpuWallTimer(op->stats().getOutputTiming);
+            DriverTraceSpan trace(this, op, "getOutput");
+            HwCounterProbe hwProbe(this, op);
             result = op->getOutput();
             if (result) {
               VELOX_CHECK(
                   result->size() > 0,
                   "Operator::getOutput() must return nullptr or a non-empty vector: {}",
                   op->stats().operatorType);
+              if (compactStringsEnabled_) {
+                compactResultStrings(result);
+              }
 
               // This code path is used only in single-threaded execution.
               blockingReason_ = BlockingReason::kWaitForConsumer;
@@ -507,6 +675,9 @@ void Driver::close() {
     LOG(FATAL) << "Driver::close is only allowed from the Driver's thread";
   }
   addStatsToTask();
+  if (!traceEvents_.empty()) {
+    ctx_->task->addTraceEvents(std::move(traceEvents_));
+  }
   for (auto& op : operators_) {
     op->close();
   }
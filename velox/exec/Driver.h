@@ -17,13 +17,16 @@
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/futures/Future.h>
 #include <folly/portability/SysSyscall.h>
+#include <limits>
 #include <memory>
 
+#include "velox/common/base/Scratch.h"
 #include "velox/common/future/VeloxPromise.h"
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/connectors/Connector.h"
 #include "velox/core/PlanNode.h"
 #include "velox/core/QueryCtx.h"
+#include "velox/exec/VectorHashMemo.h"
 
 namespace facebook::velox::exec {
 
@@ -138,6 +141,17 @@ enum class BlockingReason {
 
 std::string blockingReasonToString(BlockingReason reason);
 
+/// Sets or clears the cancellation flag polled by
+/// checkRunningDriverCancelled() on this thread. Set by the Driver for
+/// the duration of on-thread execution.
+void setThreadCancelledFlag(const std::atomic<bool>* FOLLY_NULLABLE flag);
+
+/// Throws if the Task of the Driver running on the current thread has
+/// been terminated. Called from inside long-running kernels (rehash,
+/// large sorts, spill runs) so that cancellation takes effect within a
+/// batch instead of after it. No-op on threads with no running Driver.
+void checkRunningDriverCancelled();
+
 class BlockingState {
  public:
   BlockingState(
@@ -196,6 +210,21 @@ struct DriverCtx {
   memory::MemoryPool* FOLLY_NONNULL pool;
   Driver* FOLLY_NONNULL driver;
 
+  /// Memo of key column hashes shared by the VectorHashers of this
+  /// driver's operators.
+  VectorHashMemo hashMemo;
+
+  /// Pool of reusable scratch buffers shared by this driver's
+  /// operators; lease via ScratchPtr at batch scope.
+  Scratch scratch;
+
+  /// Remaining number of rows a downstream Limit in this driver's pipeline
+  /// can still consume, including rows it will drop to satisfy OFFSET.
+  /// Source operators may clamp their batch size to this; reading past it
+  /// is wasted work. Maintained by Limit, monotonically decreasing;
+  /// int64_t max when the pipeline has no Limit.
+  int64_t rowBudget{std::numeric_limits<int64_t>::max()};
+
   explicit DriverCtx(
       std::shared_ptr<Task> _task,
       int _driverId,
@@ -211,6 +240,17 @@ struct DriverCtx {
 
 class Driver : public std::enable_shared_from_this<Driver> {
  public:
+  /// One span recorded when query tracing is enabled: an operator call
+  /// or a blocked interval, in Chrome trace-event terms.
+  struct TraceEvent {
+    // "<operatorType>.<planNodeId>.<call>" or the blocking reason.
+    std::string name;
+    int64_t startUs;
+    int64_t durationUs;
+    int32_t pipelineId;
+    int32_t driverId;
+  };
+
   Driver(
       std::unique_ptr<DriverCtx> driverCtx,
       std::vector<std::unique_ptr<Operator>> operators);
@@ -269,6 +309,22 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
   std::string toString();
 
+  /// True if per-operator-call tracing is enabled for this driver.
+  bool traceEnabled() const {
+    return traceEnabled_;
+  }
+
+  /// True if operator calls record hardware counter deltas.
+  bool hwCountersEnabled() const {
+    return hwCountersEnabled_;
+  }
+
+  /// Appends one span to the driver's trace. Called on the driver
+  /// thread only.
+  void addTraceEvent(TraceEvent event) {
+    traceEvents_.push_back(std::move(event));
+  }
+
   DriverCtx* FOLLY_NONNULL driverCtx() const {
     return ctx_.get();
   }
@@ -319,6 +375,24 @@ class Driver : public std::enable_shared_from_this<Driver> {
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
 
   bool trackOperatorCpuUsage_;
+
+  // True if operator call spans and blocked intervals are recorded.
+  bool traceEnabled_{false};
+
+  // True if output string columns fragmented over many string buffers
+  // are compacted after getOutput. From QueryConfig::compactStringBuffers().
+  bool compactStringsEnabled_{false};
+
+  // Maximum continuous on-thread time in milliseconds before the driver
+  // yields at an operator boundary; 0 means no limit. From
+  // QueryConfig::driverCpuTimeSliceLimitMs().
+  uint32_t cpuSliceLimitMs_{0};
+
+  // True if operator calls record hardware counter deltas.
+  bool hwCountersEnabled_{false};
+
+  // Recorded spans, moved into the Task on close.
+  std::vector<TraceEvent> traceEvents_;
 };
 
 using OperatorSupplier = std::function<std::unique_ptr<Operator>(
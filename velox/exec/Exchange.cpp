@@ -370,7 +370,11 @@ RowVectorPtr Exchange::getOutput() {
   }
 
   VectorStreamGroup::read(
-      inputStream_.get(), operatorCtx_->pool(), outputType_, &result_);
+      inputStream_.get(),
+      operatorCtx_->pool(),
+      outputType_,
+      &result_,
+      &serdeOptions_);
 
   stats_.inputPositions += result_->size();
   stats_.inputBytes += result_->retainedSize();
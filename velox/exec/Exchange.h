@@ -20,6 +20,7 @@
 #include <memory>
 #include "velox/common/memory/ByteStream.h"
 #include "velox/exec/Operator.h"
+#include "velox/vector/VectorStream.h"
 
 namespace facebook::velox::exec {
 
@@ -360,6 +361,8 @@ class Exchange : public SourceOperator {
             "Exchange"),
         planNodeId_(exchangeNode->id()),
         exchangeClient_(std::move(exchangeClient)) {
+    serdeOptions_.compressionCodec =
+        operatorCtx_->driverCtx()->queryConfig().exchangeCompressionCodec();
     if (operatorCtx_->driverCtx()->driverId == 0) {
       // As all Exchange operators share the same ExchangeClient, we only
       // need one to do client initialization.
@@ -409,6 +412,11 @@ class Exchange : public SourceOperator {
   std::unique_ptr<SerializedPage> currentPage_;
   std::unique_ptr<ByteStream> inputStream_;
   bool atEnd_{false};
+
+ protected:
+  // Serde options for reading pages, carrying the exchange compression
+  // codec from the query config.
+  VectorSerde::Options serdeOptions_;
 };
 
 } // namespace facebook::velox::exec
@@ -114,12 +114,21 @@ bool FilterProject::allInputProcessed() {
     return true;
   }
   if (numProcessedInputRows_ == input_->size()) {
-    input_ = nullptr;
+    releaseInput();
     return true;
   }
   return false;
 }
 
+void FilterProject::releaseInput() {
+  if (input_.unique()) {
+    // Identity-projected children are shared with the output and stay
+    // untouched; the pool only takes singly-referenced flat vectors.
+    operatorCtx_->execCtx()->vectorPool().release(input_->children());
+  }
+  input_ = nullptr;
+}
+
 bool FilterProject::isFinished() {
   return noMoreInput_ && allInputProcessed();
 }
@@ -165,7 +174,7 @@ RowVectorPtr FilterProject::getOutput() {
   auto numOut = filter(evalCtx, *rows);
   numProcessedInputRows_ = size;
   if (numOut == 0) { // no rows passed the filer
-    input_ = nullptr;
+    releaseInput();
     return nullptr;
   }
 
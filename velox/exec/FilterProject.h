@@ -62,6 +62,12 @@ class FilterProject : public Operator {
   // should return nullptr.
   bool allInputProcessed();
 
+  // Drops the reference to the fully processed input. If nothing else
+  // references the input row vector, its flat children go back to the
+  // per-driver vector pool so the next batch's expression results reuse
+  // their buffers instead of allocating.
+  void releaseInput();
+
   // Evaluate filter on all rows. Return number of rows that passed the filter.
   // Populate filterEvalCtx_.selectedBits and selectedIndices with the indices
   // of the passing rows if only some rows pass the filter. If all or no rows
@@ -70,8 +70,17 @@ GroupingSet::GroupingSet(
       rows_(mappedMemory_),
       isAdaptive_(
           operatorCtx->task()->queryCtx()->config().hashAdaptivityEnabled()),
+      // The columnar layout is incompatible with spilling, which reads
+      // accumulators through the RowContainer columns.
+      columnarAccumulatorsRequested_(
+          spillConfig == nullptr &&
+          operatorCtx->task()
+              ->queryCtx()
+              ->config()
+              .columnarAccumulatorsEnabled()),
       pool_(*operatorCtx->pool()) {
   for (auto& hasher : hashers_) {
+    hasher->setHashMemo(&operatorCtx->driverCtx()->hashMemo);
     keyChannels_.push_back(hasher->channel());
   }
   std::unordered_map<column_index_t, int> channelUseCount;
@@ -167,8 +176,7 @@ void GroupingSet::addInputForActiveRows(
   ensureInputFits(input);
 
   for (auto i = 0; i < hashers.size(); ++i) {
-    auto key = input->childAt(hashers[i]->channel())->loadedVector();
-    hashers[i]->decode(*key, activeRows_);
+    hashers[i]->decode(input->childAt(hashers[i]->channel()), activeRows_);
   }
 
   if (ignoreNullKeys_) {
@@ -208,9 +216,20 @@ void GroupingSet::addInputForActiveRows(
   masks_.addInput(input, activeRows_);
 
   for (auto i = 0; i < aggregates_.size(); ++i) {
+    auto* groups = lookup_->hits.data();
+    if (columnarAccumulators_) {
+      // Translate the group rows of the batch to the aggregate's
+      // accumulator elements.
+      columnarGroups_.resize(lookup_->hits.size());
+      auto* rowsContainer = table_->rows();
+      for (auto row : lookup_->rows) {
+        rowsContainer->accumulatorPointers(
+            i, &groups[row], 1, &columnarGroups_[row]);
+      }
+      groups = columnarGroups_.data();
+    }
     if (!lookup_->newGroups.empty()) {
-      aggregates_[i]->initializeNewGroups(
-          lookup_->hits.data(), lookup_->newGroups);
+      aggregates_[i]->initializeNewGroups(groups, lookup_->newGroups);
     }
 
     const auto& rows = getSelectivityVector(i);
@@ -226,11 +245,10 @@ void GroupingSet::addInputForActiveRows(
     const bool canPushdown = (&rows == &activeRows_) && mayPushdown &&
         mayPushdown_[i] && areAllLazyNotLoaded(tempVectors_);
     if (isRawInput_) {
-      aggregates_[i]->addRawInput(
-          lookup_->hits.data(), rows, tempVectors_, canPushdown);
+      aggregates_[i]->addRawInput(groups, rows, tempVectors_, canPushdown);
     } else {
       aggregates_[i]->addIntermediateResults(
-          lookup_->hits.data(), rows, tempVectors_, canPushdown);
+          groups, rows, tempVectors_, canPushdown);
     }
   }
   tempVectors_.clear();
@@ -249,11 +267,20 @@ void GroupingSet::addRemainingInput() {
 void GroupingSet::createHashTable() {
   if (ignoreNullKeys_) {
     table_ = HashTable<true>::createForAggregation(
-        std::move(hashers_), aggregates_, mappedMemory_);
+        std::move(hashers_),
+        aggregates_,
+        mappedMemory_,
+        columnarAccumulatorsRequested_);
   } else {
     table_ = HashTable<false>::createForAggregation(
-        std::move(hashers_), aggregates_, mappedMemory_);
+        std::move(hashers_),
+        aggregates_,
+        mappedMemory_,
+        columnarAccumulatorsRequested_);
   }
+  // The container falls back to the row-wise layout if some accumulator
+  // is not fixed-width.
+  columnarAccumulators_ = table_->rows()->columnarAccumulators();
   lookup_ = std::make_unique<HashLookup>(table_->hashers());
   if (!isAdaptive_ && table_->hashMode() != BaseHashTable::HashMode::kHash) {
     table_->forceGenericHashMode();
@@ -440,14 +467,21 @@ void GroupingSet::extractGroups(
     rows.extractColumn(groups.data(), groups.size(), i, keyVector);
   }
   for (int32_t i = 0; i < aggregates_.size(); ++i) {
-    aggregates_[i]->finalize(groups.data(), groups.size());
+    auto* groupsData = groups.data();
+    if (columnarAccumulators_) {
+      columnarGroups_.resize(groups.size());
+      rows.accumulatorPointers(
+          i, groups.data(), groups.size(), columnarGroups_.data());
+      groupsData = columnarGroups_.data();
+    }
+    aggregates_[i]->finalize(groupsData, groups.size());
     auto& aggregateVector = result->childAt(i + totalKeys);
     if (isPartial_) {
       aggregates_[i]->extractAccumulators(
-          groups.data(), groups.size(), &aggregateVector);
+          groupsData, groups.size(), &aggregateVector);
     } else {
       aggregates_[i]->extractValues(
-          groups.data(), groups.size(), &aggregateVector);
+          groupsData, groups.size(), &aggregateVector);
     }
   }
 }
@@ -577,7 +611,8 @@ void GroupingSet::spill(int64_t targetRows, int64_t targetBytes) {
         spillConfig_->filePath,
         fileSize,
         Spiller::spillPool(),
-        spillConfig_->executor);
+        spillConfig_->executor,
+        spillConfig_->compressionCodec);
   }
   spiller_->spill(targetRows, targetBytes);
 }
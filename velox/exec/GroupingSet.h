@@ -64,6 +64,13 @@ class GroupingSet {
 
   uint64_t allocatedBytes() const;
 
+  /// Returns the average size of the accumulated group rows, or
+  /// std::nullopt before any input. Used to size output batches.
+  std::optional<int64_t> estimateOutputRowSize() const {
+    return table_ != nullptr ? table_->rows()->estimateRowSize()
+                             : std::nullopt;
+  }
+
   void resetPartial();
 
   const HashLookup& hashLookup() const;
@@ -204,6 +211,19 @@ class GroupingSet {
   AllocationPool rows_;
   const bool isAdaptive_;
 
+  // True if the columnar accumulator layout should be requested for the
+  // hash table's RowContainer.
+  const bool columnarAccumulatorsRequested_;
+
+  // True if 'table_' stores accumulators columnar. Group pointers must
+  // then be translated with accumulatorGroups() before calling into the
+  // aggregates.
+  bool columnarAccumulators_{false};
+
+  // Scratch for translated accumulator pointers. Parallel to
+  // 'lookup_->hits' or to the groups being extracted.
+  std::vector<char*> columnarGroups_;
+
   bool noMoreInput_{false};
 
   /// In case of partial streaming aggregation, the input vector passed to
@@ -33,7 +33,6 @@ HashAggregation::HashAggregation(
           aggregationNode->step() == core::AggregationNode::Step::kPartial
               ? "PartialAggregation"
               : "Aggregation"),
-      outputBatchSize_{driverCtx->queryConfig().preferredOutputBatchSize()},
       isPartialOutput_(isPartialOutput(aggregationNode->step())),
       isDistinct_(aggregationNode->aggregates().empty()),
       isGlobal_(aggregationNode->groupingKeys().empty()),
@@ -42,6 +41,10 @@ HashAggregation::HashAggregation(
           driverCtx->queryConfig().partialAggregationGoodPct()),
       maxExtendedPartialAggregationMemoryUsage_(
           driverCtx->queryConfig().maxExtendedPartialAggregationMemoryUsage()),
+      abandonPartialAggregationMinRows_(
+          driverCtx->queryConfig().abandonPartialAggregationMinRows()),
+      abandonPartialAggregationMinPct_(
+          driverCtx->queryConfig().abandonPartialAggregationMinPct()),
       spillConfig_(makeOperatorSpillConfig(
           *operatorCtx_->task()->queryCtx(),
           *operatorCtx_,
@@ -182,9 +185,15 @@ void HashAggregation::addInput(RowVectorPtr input) {
   // NOTE: we should not trigger partial output flush in case of global
   // aggregation as the final aggregator will handle it the same way as the
   // partial aggregator. Hence, we have to use more memory anyway.
-  if (isPartialOutput_ && !isGlobal_ &&
-      groupingSet_->allocatedBytes() > maxPartialAggregationMemoryUsage_) {
-    partialFull_ = true;
+  if (isPartialOutput_ && !isGlobal_) {
+    if (abandonedPartial_) {
+      // Abandoned: flush every batch, the table never grows past one
+      // batch of groups.
+      partialFull_ = true;
+    } else if (
+        groupingSet_->allocatedBytes() > maxPartialAggregationMemoryUsage_) {
+      partialFull_ = true;
+    }
   }
 
   if (isDistinct_) {
@@ -220,9 +229,17 @@ void HashAggregation::resetPartialOutputIfNeed() {
       "partialAggregationPct", RuntimeCounter(aggregationPct));
   groupingSet_->resetPartial();
   partialFull_ = false;
+  if (!abandonedPartial_ && !isDistinct_ &&
+      numInputRows_ >= abandonPartialAggregationMinRows_ &&
+      aggregationPct >= abandonPartialAggregationMinPct_) {
+    // The keys barely repeat; stop buffering and leave the reduction
+    // to the final aggregation.
+    abandonedPartial_ = true;
+    stats().addRuntimeStat("abandonedPartialAggregation", RuntimeCounter(1));
+  }
   numOutputRows_ = 0;
   numInputRows_ = 0;
-  if (!finished_) {
+  if (!finished_ && !abandonedPartial_) {
     maybeIncreasePartialAggregationMemoryUsage(aggregationPct);
   }
 }
@@ -300,7 +317,10 @@ RowVectorPtr HashAggregation::getOutput() {
     return output;
   }
 
-  auto batchSize = isGlobal_ ? 1 : outputBatchSize_;
+  // Size the batch from the measured width of the group rows, so wide
+  // groups produce fewer rows per batch and narrow ones more.
+  const auto batchSize =
+      isGlobal_ ? 1 : outputBatchRows(groupingSet_->estimateOutputRowSize());
 
   // Reuse output vectors if possible.
   prepareOutput(batchSize);
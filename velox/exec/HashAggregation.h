@@ -64,21 +64,26 @@ class HashAggregation : public Operator {
   /// measure of the effectiveness of the partial aggregation.
   void maybeIncreasePartialAggregationMemoryUsage(double aggregationPct);
 
-  /// Maximum number of rows in the output batch.
-  const uint32_t outputBatchSize_;
-
   const bool isPartialOutput_;
   const bool isDistinct_;
   const bool isGlobal_;
   const std::shared_ptr<memory::MemoryUsageTracker> memoryTracker_;
   const double partialAggregationGoodPct_;
   const int64_t maxExtendedPartialAggregationMemoryUsage_;
+  const int64_t abandonPartialAggregationMinRows_;
+  const int32_t abandonPartialAggregationMinPct_;
   const std::optional<Spiller::Config> spillConfig_;
 
   int64_t maxPartialAggregationMemoryUsage_;
   std::unique_ptr<GroupingSet> groupingSet_;
 
   bool partialFull_ = false;
+
+  /// True once partial aggregation was abandoned for poor reduction:
+  /// every batch is flushed right away, so the hash table stays one
+  /// batch small and stops buffering high-cardinality keys. The final
+  /// aggregation does the real work.
+  bool abandonedPartial_ = false;
   bool newDistincts_ = false;
   bool finished_ = false;
   RowContainerIterator resultIterator_;
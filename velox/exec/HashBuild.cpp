@@ -83,16 +83,25 @@ HashBuild::HashBuild(
     types.emplace_back(outputType->childAt(channel));
   }
 
+  // For left semi and anti joins without a filter only key existence
+  // matters: the table keeps the distinct-key skeleton (setupTable
+  // drops duplicate keys for these types) and the payload columns are
+  // not stored at all.
+  const bool dropPayload = !joinNode_->filter() &&
+      (joinNode_->isLeftSemiJoin() || joinNode_->isNullAwareAntiJoin());
+
   // Identify the non-key build side columns and make a decoder for each.
-  const auto numDependents = outputType->size() - numKeys;
+  const auto numDependents = dropPayload ? 0 : outputType->size() - numKeys;
   dependentChannels_.reserve(numDependents);
   decoders_.reserve(numDependents);
-  for (auto i = 0; i < outputType->size(); ++i) {
-    if (keyChannelPosition.find(i) == keyChannelPosition.end()) {
-      dependentChannels_.emplace_back(i);
-      decoders_.emplace_back(std::make_unique<DecodedVector>());
-      names.emplace_back(outputType->nameOf(i));
-      types.emplace_back(outputType->childAt(i));
+  if (!dropPayload) {
+    for (auto i = 0; i < outputType->size(); ++i) {
+      if (keyChannelPosition.find(i) == keyChannelPosition.end()) {
+        dependentChannels_.emplace_back(i);
+        decoders_.emplace_back(std::make_unique<DecodedVector>());
+        names.emplace_back(outputType->nameOf(i));
+        types.emplace_back(outputType->childAt(i));
+      }
     }
   }
 
@@ -156,6 +165,9 @@ void HashBuild::setupTable() {
     }
   }
   analyzeKeys_ = table_->hashMode() != BaseHashTable::HashMode::kHash;
+  for (auto& hasher : table_->hashers()) {
+    hasher->setHashMemo(&operatorCtx_->driverCtx()->hashMemo);
+  }
 }
 
 void HashBuild::setupSpiller(SpillPartition* spillPartition) {
@@ -190,7 +202,8 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
               ->maxTotalBytes() *
           spillConfig.fileSizeFactor,
       Spiller::spillPool(),
-      spillConfig.executor);
+      spillConfig.executor,
+      spillConfig.compressionCodec);
 
   if (spillPartition == nullptr) {
     spillGroup_->addOperator(
@@ -280,8 +293,7 @@ void HashBuild::addInput(RowVectorPtr input) {
   auto& hashers = table_->hashers();
 
   for (auto i = 0; i < hashers.size(); ++i) {
-    auto key = input->childAt(hashers[i]->channel())->loadedVector();
-    hashers[i]->decode(*key, activeRows_);
+    hashers[i]->decode(input->childAt(hashers[i]->channel()), activeRows_);
   }
 
   if (!isRightJoin(joinType_) && !isFullJoin(joinType_) &&
@@ -430,6 +442,9 @@ bool HashBuild::reserveMemory(const RowVectorPtr& input) {
   if (tracker->maybeReserve(targetIncrement)) {
     return true;
   }
+  stats_.addRuntimeStat(
+      "memoryReservationFailures",
+      RuntimeCounter(targetIncrement, RuntimeCounter::Unit::kBytes));
   numSpillRows_ = std::max<int64_t>(
       1, targetIncrement / (rows->fixedRowSize() + outOfLineBytesPerRow));
   numSpillBytes_ = numSpillRows_ * outOfLineBytesPerRow;
@@ -711,7 +726,25 @@ bool HashBuild::finishHashBuild() {
         }
       }
     }
-    table_->prepareJoinTable(std::move(otherTables));
+    // With radix-partitioned build, rows are partitioned by a prefix of
+    // the hash and the table is built partition-parallel on the Task's
+    // executor. Without an executor the build falls back to merging the
+    // per-driver containers on this thread.
+    // The merged table outlives the build drivers' hash memos.
+    for (auto& hasher : table_->hashers()) {
+      hasher->setHashMemo(nullptr);
+    }
+    for (auto& other : otherTables) {
+      for (auto& hasher : other->hashers()) {
+        hasher->setHashMemo(nullptr);
+      }
+    }
+    auto* queryCtx = operatorCtx_->task()->queryCtx().get();
+    table_->prepareJoinTable(
+        std::move(otherTables),
+        joinNode_->isRadixPartitionedBuild() && queryCtx->isExecutorSupplied()
+            ? queryCtx->executor()
+            : nullptr);
 
     addRuntimeStats();
     if (joinBridge_->setHashTable(
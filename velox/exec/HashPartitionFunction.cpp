@@ -78,9 +78,22 @@ void HashPartitionFunction::partition(
     for (auto i = 0; i < size; ++i) {
       partitions[i] = hashBitRange_->partition(hashes_[i]);
     }
+  } else if ((numPartitions_ & (numPartitions_ - 1)) == 0) {
+    // Power of two: a mask gives the same mapping as the modulo and
+    // stays consistent with HashBitRange over the low bits.
+    const uint64_t mask = numPartitions_ - 1;
+    for (auto i = 0; i < size; ++i) {
+      partitions[i] = hashes_[i] & mask;
+    }
   } else {
+    // Map hashes to destinations with multiply-shift (Lemire's
+    // fastrange) instead of a division per row. The mapping is uniform
+    // for uniform hashes and the loop vectorizes; all producers of a
+    // partitioning run this same function, so assignment stays
+    // consistent.
     for (auto i = 0; i < size; ++i) {
-      partitions[i] = hashes_[i] % numPartitions_;
+      partitions[i] = static_cast<uint32_t>(
+          (static_cast<__uint128_t>(hashes_[i]) * numPartitions_) >> 64);
     }
   }
 }
@@ -109,6 +109,7 @@ HashProbe::HashProbe(
     keyChannels_.emplace_back(channel);
     hashers_.push_back(
         std::make_unique<VectorHasher>(probeType->childAt(channel), channel));
+    hashers_.back()->setHashMemo(&driverCtx->hashMemo);
   }
   lookup_ = std::make_unique<HashLookup>(hashers_);
   auto buildType = joinNode->sources()[1]->outputType();
@@ -238,6 +239,14 @@ BlockingReason HashProbe::isBlocked(ContinueFuture* future) {
           }
         }
       }
+    } else if (
+        (isInnerJoin(joinType_) || isLeftSemiJoin(joinType_) ||
+         isRightSemiJoin(joinType_)) &&
+        table_->hashMode() == BaseHashTable::HashMode::kHash) {
+      // In generic hash mode the hashers have no value sets to make
+      // exact filters from. Push an approximate Bloom filter of the
+      // build keys instead.
+      addBloomDynamicFilter();
     }
     if (isNullAwareAntiJoin(joinType_) && filter_) {
       prepareForNullAwareAntiJoinWithFilter();
@@ -247,13 +256,77 @@ BlockingReason HashProbe::isBlocked(ContinueFuture* future) {
   return BlockingReason::kNotBlocked;
 }
 
+namespace {
+template <TypeKind Kind>
+void addToBloomFilter(
+    common::BigintBloomFilter& bloom,
+    const VectorPtr& keys,
+    vector_size_t size) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  if constexpr (std::is_integral_v<T>) {
+    auto* flat = keys->asUnchecked<FlatVector<T>>();
+    for (auto i = 0; i < size; ++i) {
+      if (!flat->isNullAt(i)) {
+        bloom.insert(flat->valueAt(i));
+      }
+    }
+  } else {
+    VELOX_UNREACHABLE("Bloom filter pushdown applies to integer keys only");
+  }
+}
+} // namespace
+
+void HashProbe::addBloomDynamicFilter() {
+  if (keyChannels_.size() != 1) {
+    return;
+  }
+  const auto& hasher = table_->hashers()[0];
+  const auto typeKind = hasher->typeKind();
+  switch (typeKind) {
+    case TypeKind::BIGINT:
+    case TypeKind::INTEGER:
+    case TypeKind::SMALLINT:
+    case TypeKind::TINYINT:
+      break;
+    default:
+      return;
+  }
+  const auto numDistinct = table_->numDistinct();
+  if (numDistinct > kMaxBloomFilterBuildRows) {
+    return;
+  }
+  auto channels = operatorCtx_->driverCtx()->driver->canPushdownFilters(
+      this, keyChannels_);
+  if (channels.find(keyChannels_[0]) == channels.end()) {
+    return;
+  }
+  auto bloom = std::make_unique<common::BigintBloomFilter>(
+      numDistinct, false /*nullAllowed*/);
+  constexpr int32_t kBatch = 1024;
+  std::vector<char*> rows(kBatch);
+  auto keyVector =
+      BaseVector::create(hasher->type(), kBatch, operatorCtx_->pool());
+  RowContainerIterator iter;
+  auto* rowContainer = table_->rows();
+  while (auto numRows = rowContainer->listRows(&iter, kBatch, rows.data())) {
+    keyVector->resize(numRows);
+    rowContainer->extractColumn(rows.data(), numRows, 0, keyVector);
+    VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        addToBloomFilter, typeKind, *bloom, keyVector, numRows);
+  }
+  dynamicFilters_.emplace(keyChannels_[0], std::move(bloom));
+  hasApproximateDynamicFilter_ = true;
+}
+
 void HashProbe::clearDynamicFilters() {
   // The join can be completely replaced with a pushed down
   // filter when the following conditions are met:
   //  * hash table has a single key with unique values,
-  //  * build side has no dependent columns.
+  //  * build side has no dependent columns,
+  //  * the filter is exact, not an approximate Bloom filter.
   if (keyChannels_.size() == 1 && !table_->hasDuplicateKeys() &&
-      tableResultProjections_.empty() && !filter_ && !dynamicFilters_.empty()) {
+      tableResultProjections_.empty() && !filter_ && !dynamicFilters_.empty() &&
+      !hasApproximateDynamicFilter_) {
     canReplaceWithDynamicFilter_ = true;
   }
 
@@ -281,8 +354,7 @@ void HashProbe::addInput(RowVectorPtr input) {
   nonNullRows_.setAll();
 
   for (auto i = 0; i < hashers_.size(); ++i) {
-    auto key = input_->childAt(hashers_[i]->channel())->loadedVector();
-    hashers_[i]->decode(*key, nonNullRows_);
+    hashers_[i]->decode(input_->childAt(hashers_[i]->channel()), nonNullRows_);
   }
 
   deselectRowsWithNulls(hashers_, nonNullRows_);
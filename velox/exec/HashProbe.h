@@ -64,6 +64,12 @@ class HashProbe : public Operator {
   // Setup the column mapping and build side table for filter evaluation.
   void prepareForNullAwareAntiJoinWithFilter();
 
+  // Builds an approximate Bloom filter of the build-side keys and adds
+  // it to 'dynamicFilters_'. Used when the table is in generic hash
+  // mode, where exact value filters are not available. Applies only to
+  // single integer join keys of a bounded build cardinality.
+  void addBloomDynamicFilter();
+
   // Check if output_ can be re-used and if not make a new one.
   void prepareOutput(vector_size_t size);
 
@@ -105,6 +111,10 @@ class HashProbe : public Operator {
 
   void ensureLoadedIfNotAtEnd(column_index_t channel);
 
+  // Max build-side cardinality for which a Bloom filter is built and
+  // pushed down. Bounds the cost of the extra pass over the build rows.
+  static constexpr int64_t kMaxBloomFilterBuildRows = 16 << 20;
+
   // TODO: Define batch size as bytes based on RowContainer row sizes.
   const uint32_t outputBatchSize_;
 
@@ -118,6 +128,10 @@ class HashProbe : public Operator {
   // True if the join can become a no-op starting with the next batch of input.
   bool canReplaceWithDynamicFilter_{false};
 
+  // True if a pushed down dynamic filter is approximate (Bloom), in
+  // which case the join can never be replaced by the filter.
+  bool hasApproximateDynamicFilter_{false};
+
   // True if the join became a no-op after pushing down the filter.
   bool replacedWithDynamicFilter_{false};
 
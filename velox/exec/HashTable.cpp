@@ -20,6 +20,7 @@
 #include "velox/common/base/SimdUtil.h"
 #include "velox/common/process/ProcessBase.h"
 #include "velox/exec/ContainerRowSerde.h"
+#include "velox/exec/Driver.h"
 #include "velox/vector/VectorTypeUtils.h"
 
 namespace facebook::velox::exec {
@@ -32,7 +33,8 @@ HashTable<ignoreNullKeys>::HashTable(
     bool allowDuplicates,
     bool isJoinBuild,
     bool hasProbedFlag,
-    memory::MappedMemory* mappedMemory)
+    memory::MappedMemory* mappedMemory,
+    bool columnarAccumulators)
     : BaseHashTable(std::move(hashers)), isJoinBuild_(isJoinBuild) {
   std::vector<TypePtr> keys;
   for (auto& hasher : hashers_) {
@@ -51,10 +53,17 @@ HashTable<ignoreNullKeys>::HashTable(
       hasProbedFlag,
       hashMode_ != HashMode::kHash,
       mappedMemory,
-      ContainerRowSerde::instance());
+      ContainerRowSerde::instance(),
+      columnarAccumulators);
   nextOffset_ = rows_->nextOffset();
 }
 
+// Number of probe rows whose buckets are prefetched as a group before
+// any of the group is resolved. Sized to keep well under the number of
+// outstanding misses the memory subsystem sustains while covering the
+// latency of a miss to DRAM.
+constexpr int32_t kPrefetchRows = 16;
+
 class ProbeState {
  public:
   enum class Operation { kProbe, kInsert, kErase };
@@ -75,6 +84,17 @@ class ProbeState {
     return (hash & sizeMask) & ~(sizeof(BaseHashTable::TagVector) - 1);
   }
 
+  // Prefetches the tag word and the corresponding row pointers for the
+  // bucket of 'hash'. Issued for a batch of probe rows ahead of
+  // resolving any of them so that the cache misses of the batch overlap
+  // instead of being taken one at a time.
+  static inline void
+  prefetchBucket(uint8_t* tags, char** table, uint64_t sizeMask, uint64_t hash) {
+    auto tagIndex = tagsByteOffset(hash, sizeMask);
+    __builtin_prefetch(tags + tagIndex);
+    __builtin_prefetch(table + tagIndex);
+  }
+
   int32_t row() const {
     return row_;
   }
@@ -502,6 +522,34 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
   ProbeState state2;
   ProbeState state3;
   ProbeState state4;
+  for (; probeIndex + kPrefetchRows <= numProbes;) {
+    // Prefetch the buckets for the whole group before resolving any of
+    // its probes. With the table many times the size of L3, each bucket
+    // access is a miss and the misses of the group overlap.
+    for (auto i = 0; i < kPrefetchRows; ++i) {
+      ProbeState::prefetchBucket(
+          tags_, table_, sizeMask_, lookup.hashes[rows[probeIndex + i]]);
+    }
+    for (auto end = probeIndex + kPrefetchRows; probeIndex < end;
+         probeIndex += 4) {
+      int32_t row = rows[probeIndex];
+      state1.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
+      row = rows[probeIndex + 1];
+      state2.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
+      row = rows[probeIndex + 2];
+      state3.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
+      row = rows[probeIndex + 3];
+      state4.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
+      state1.firstProbe(table_, 0);
+      state2.firstProbe(table_, 0);
+      state3.firstProbe(table_, 0);
+      state4.firstProbe(table_, 0);
+      fullProbe<true>(lookup, state1, false);
+      fullProbe<true>(lookup, state2, false);
+      fullProbe<true>(lookup, state3, false);
+      fullProbe<true>(lookup, state4, false);
+    }
+  }
   for (; probeIndex + 4 <= numProbes; probeIndex += 4) {
     int32_t row = rows[probeIndex];
     state1.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
@@ -540,6 +588,35 @@ void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
   const uint64_t* keys = lookup.normalizedKeys.data();
   const uint64_t* hashes = lookup.hashes.data();
   char** hits = lookup.hits.data();
+  for (; probeIndex + kPrefetchRows <= numProbes;) {
+    for (auto i = 0; i < kPrefetchRows; ++i) {
+      ProbeState::prefetchBucket(
+          tags_, table_, sizeMask_, hashes[rows[probeIndex + i]]);
+    }
+    for (auto end = probeIndex + kPrefetchRows; probeIndex < end;
+         probeIndex += 4) {
+      int32_t row = rows[probeIndex];
+      state1.preProbe(tags_, sizeMask_, hashes[row], row);
+      row = rows[probeIndex + 1];
+      state2.preProbe(tags_, sizeMask_, hashes[row], row);
+      row = rows[probeIndex + 2];
+      state3.preProbe(tags_, sizeMask_, hashes[row], row);
+      row = rows[probeIndex + 3];
+      state4.preProbe(tags_, sizeMask_, hashes[row], row);
+      state1.firstProbe(table_, 0);
+      state2.firstProbe(table_, 0);
+      state3.firstProbe(table_, 0);
+      state4.firstProbe(table_, 0);
+      hits[state1.row()] =
+          state1.joinNormalizedKeyFullProbe(tags_, table_, sizeMask_, keys);
+      hits[state2.row()] =
+          state2.joinNormalizedKeyFullProbe(tags_, table_, sizeMask_, keys);
+      hits[state3.row()] =
+          state3.joinNormalizedKeyFullProbe(tags_, table_, sizeMask_, keys);
+      hits[state4.row()] =
+          state4.joinNormalizedKeyFullProbe(tags_, table_, sizeMask_, keys);
+    }
+  }
   for (; probeIndex + 4 <= numProbes; probeIndex += 4) {
     int32_t row = rows[probeIndex];
     state1.preProbe(tags_, sizeMask_, hashes[row], row);
@@ -1026,6 +1103,7 @@ void HashTable<ignoreNullKeys>::rehash() {
     RowContainerIterator iterator;
     int32_t numGroups;
     do {
+      checkRunningDriverCancelled();
       numGroups = (i == 0 ? this : otherTables_[i - 1].get())
                       ->rows()
                       ->listRows(&iterator, kHashBatchSize, groups);
@@ -1354,6 +1432,41 @@ void HashTable<ignoreNullKeys>::prepareJoinTable(
   } else {
     decideHashMode(0);
   }
+  packDuplicateChains();
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::packDuplicateChains() {
+  if (!nextOffset_ || !hasDuplicates_ || !table_) {
+    return;
+  }
+  for (int64_t i = 0; i < size_; ++i) {
+    auto* head = table_[i];
+    if (!head || !nextRow(head)) {
+      continue;
+    }
+    int64_t numRows = 1;
+    for (auto* row = nextRow(head); row; row = nextRow(row)) {
+      ++numRows;
+    }
+    if (numRows < kMinPackedDuplicates || numRows > kMaxPackedDuplicates) {
+      continue;
+    }
+    // One pointer of slack covers aligning rows() to an 8-byte
+    // boundary from the 4-byte aligned block payload.
+    auto* header = rows_->stringAllocator().allocate(
+        sizeof(DuplicateRowList) + sizeof(char*) +
+        numRows * sizeof(char*));
+    auto* list = reinterpret_cast<DuplicateRowList*>(header->begin());
+    list->size = numRows;
+    auto** listRows = list->rows();
+    int64_t index = 0;
+    for (auto* row = head; row; row = nextRow(row)) {
+      listRows[index++] = row;
+    }
+    nextRow(head) = reinterpret_cast<char*>(
+        reinterpret_cast<uintptr_t>(list) | kDuplicateListTag);
+  }
 }
 
 template <bool ignoreNullKeys>
@@ -1369,6 +1482,26 @@ int32_t HashTable<ignoreNullKeys>::listJoinResults(
   int numOut = 0;
   auto maxOut = inputRows.size();
   while (iter.lastRowIndex < iter.rows->size()) {
+    if (iter.dupRows) {
+      // Emit the remainder of a packed duplicate list: an array scan
+      // with no pointer chasing.
+      auto row = (*iter.rows)[iter.lastRowIndex];
+      while (iter.dupIndex < iter.dupSize) {
+        inputRows[numOut] = row; // NOLINT
+        hits[numOut] = iter.dupRows[iter.dupIndex++];
+        ++numOut;
+        if (numOut >= maxOut) {
+          if (iter.dupIndex >= iter.dupSize) {
+            iter.dupRows = nullptr;
+            ++iter.lastRowIndex;
+          }
+          return numOut;
+        }
+      }
+      iter.dupRows = nullptr;
+      ++iter.lastRowIndex;
+      continue;
+    }
     if (!iter.nextHit) {
       auto row = (*iter.rows)[iter.lastRowIndex];
       iter.nextHit = (*iter.hits)[row]; // NOLINT
@@ -1385,6 +1518,18 @@ int32_t HashTable<ignoreNullKeys>::listJoinResults(
         }
         continue;
       }
+      if (nextOffset_) {
+        auto* next = nextRow(iter.nextHit);
+        if (next && isDuplicateList(next)) {
+          // All rows of this key, head included, are in the packed list.
+          auto* list = duplicateList(next);
+          iter.nextHit = nullptr;
+          iter.dupRows = list->rows();
+          iter.dupSize = list->size;
+          iter.dupIndex = 0;
+          continue;
+        }
+      }
     }
     while (iter.nextHit) {
       char* next = nullptr;
@@ -74,6 +74,9 @@ class BaseHashTable {
       hits = &lookup.hits;
       nextHit = nullptr;
       lastRowIndex = 0;
+      dupRows = nullptr;
+      dupSize = 0;
+      dupIndex = 0;
     }
 
     bool atEnd() const {
@@ -84,6 +87,10 @@ class BaseHashTable {
     const raw_vector<char*>* FOLLY_NULLABLE hits{nullptr};
     char* FOLLY_NULLABLE nextHit{nullptr};
     vector_size_t lastRowIndex{0};
+    // Remainder of the packed duplicate row list being emitted, if any.
+    char* const* FOLLY_NULLABLE dupRows{nullptr};
+    int32_t dupSize{0};
+    int32_t dupIndex{0};
   };
 
   struct RowsIterator {
@@ -272,12 +279,14 @@ class HashTable : public BaseHashTable {
       bool allowDuplicates,
       bool isJoinBuild,
       bool hasProbedFlag,
-      memory::MappedMemory* FOLLY_NULLABLE memory);
+      memory::MappedMemory* FOLLY_NULLABLE memory,
+      bool columnarAccumulators = false);
 
   static std::unique_ptr<HashTable> createForAggregation(
       std::vector<std::unique_ptr<VectorHasher>>&& hashers,
       const std::vector<std::unique_ptr<Aggregate>>& aggregates,
-      memory::MappedMemory* FOLLY_NULLABLE memory) {
+      memory::MappedMemory* FOLLY_NULLABLE memory,
+      bool columnarAccumulators = false) {
     return std::make_unique<HashTable>(
         std::move(hashers),
         aggregates,
@@ -285,7 +294,8 @@ class HashTable : public BaseHashTable {
         false, // allowDuplicates
         false, // isJoinBuild
         false, // hasProbedFlag
-        memory);
+        memory,
+        columnarAccumulators);
   }
 
   static std::unique_ptr<HashTable> createForJoin(
@@ -571,6 +581,51 @@ class HashTable : public BaseHashTable {
   // Offset of next row link for join build side, 0 if none. Copied
   // from 'rows_'.
   int32_t nextOffset_;
+
+  // Chains of duplicate build rows at least this long are packed into
+  // contiguous row pointer arrays when the join table becomes
+  // probe-only, so listJoinResults iterates an array instead of
+  // chasing a pointer per row.
+  static constexpr int32_t kMinPackedDuplicates = 8;
+
+  // Upper bound on a packed list's length. A HashStringAllocator block
+  // must fit in one slab run, and the largest backing size class is 256
+  // pages of 4KB; the margin covers arena headers and end markers.
+  // Chains longer than this keep the linked representation instead of
+  // failing the allocation.
+  static constexpr int32_t kMaxPackedDuplicates =
+      (256 * 4096 - 128) / sizeof(char*);
+
+  // A packed span of all rows of one key: 'size' row pointers follow
+  // the count at the next 8-byte boundary, since the arena only
+  // guarantees 4-byte alignment for block payloads. Allocated from the
+  // payload arena; freed with it. The head row's next pointer is set to
+  // the list, tagged with kDuplicateListTag in its low bit (rows are
+  // 8-byte aligned).
+  struct DuplicateRowList {
+    int32_t size;
+
+    char** rows() {
+      return reinterpret_cast<char**>(bits::roundUp(
+          reinterpret_cast<uintptr_t>(this) + sizeof(int32_t),
+          sizeof(char*)));
+    }
+  };
+
+  static constexpr uintptr_t kDuplicateListTag = 1;
+
+  static bool isDuplicateList(const char* FOLLY_NULLABLE pointer) {
+    return reinterpret_cast<uintptr_t>(pointer) & kDuplicateListTag;
+  }
+
+  static DuplicateRowList* duplicateList(char* pointer) {
+    return reinterpret_cast<DuplicateRowList*>(
+        reinterpret_cast<uintptr_t>(pointer) & ~kDuplicateListTag);
+  }
+
+  // Packs long duplicate chains into DuplicateRowLists. Called once at
+  // the end of prepareJoinTable(), after which no rows are inserted.
+  void packDuplicateChains();
   uint8_t* FOLLY_NULLABLE tags_ = nullptr;
   char* FOLLY_NULLABLE* FOLLY_NULLABLE table_ = nullptr;
   memory::MappedMemory::ContiguousAllocation tableAllocation_;
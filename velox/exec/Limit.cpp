@@ -16,6 +16,29 @@
 #include "velox/exec/Limit.h"
 
 namespace facebook::velox::exec {
+namespace {
+// True if only row-preserving or row-narrowing streaming operators
+// (filters, projections) sit between 'limitNode' and the pipeline's
+// table scan, so that the scan may clamp its batches to the limit's
+// remaining row budget. An accumulating operator in between, e.g. a
+// partial aggregation or sort, consumes the entire scan output no
+// matter the limit, and clamping would read the whole table in
+// budget-sized batches.
+bool mayPublishRowBudget(const core::LimitNode& limitNode) {
+  const core::PlanNode* node = limitNode.sources()[0].get();
+  for (;;) {
+    if (dynamic_cast<const core::TableScanNode*>(node)) {
+      return true;
+    }
+    if (!dynamic_cast<const core::FilterNode*>(node) &&
+        !dynamic_cast<const core::ProjectNode*>(node)) {
+      return false;
+    }
+    node = node->sources()[0].get();
+  }
+}
+} // namespace
+
 Limit::Limit(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -27,7 +50,8 @@ Limit::Limit(
           limitNode->id(),
           "Limit"),
       remainingOffset_{limitNode->offset()},
-      remainingLimit_{limitNode->count()} {
+      remainingLimit_{limitNode->count()},
+      publishesRowBudget_{mayPublishRowBudget(*limitNode)} {
   isIdentityProjection_ = true;
 
   const auto numColumns = limitNode->outputType()->size();
@@ -35,6 +59,17 @@ Limit::Limit(
   for (column_index_t i = 0; i < numColumns; ++i) {
     identityProjections_.emplace_back(i, i);
   }
+
+  publishRowBudget();
+}
+
+void Limit::publishRowBudget() {
+  if (!publishesRowBudget_) {
+    return;
+  }
+  auto& budget = operatorCtx_->driverCtx()->rowBudget;
+  budget = std::min<int64_t>(
+      budget, (int64_t)remainingOffset_ + (int64_t)remainingLimit_);
 }
 
 bool Limit::needsInput() const {
@@ -55,6 +90,7 @@ RowVectorPtr Limit::getOutput() {
 
   if (remainingOffset_ >= inputSize) {
     remainingOffset_ -= inputSize;
+    publishRowBudget();
     input_ = nullptr;
     return nullptr;
   }
@@ -70,6 +106,7 @@ RowVectorPtr Limit::getOutput() {
     auto output = fillOutput(outputSize, indices);
     remainingOffset_ = 0;
     remainingLimit_ -= outputSize;
+    publishRowBudget();
     input_ = nullptr;
     if (remainingLimit_ == 0) {
       finished_ = true;
@@ -83,6 +120,7 @@ RowVectorPtr Limit::getOutput() {
 
   if (remainingLimit_ >= inputSize) {
     remainingLimit_ -= inputSize;
+    publishRowBudget();
     auto output = input_;
     input_.reset();
     return output;
@@ -96,6 +134,7 @@ RowVectorPtr Limit::getOutput() {
       input_->children());
   input_.reset();
   remainingLimit_ = 0;
+  publishRowBudget();
   return output;
 }
 } // namespace facebook::velox::exec
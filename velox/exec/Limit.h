@@ -39,8 +39,19 @@ class Limit : public Operator {
   }
 
  private:
+  // Publishes the number of rows this Limit can still consume (including
+  // rows dropped for OFFSET) to DriverCtx::rowBudget so source operators
+  // in the same pipeline stop producing past it. No-op unless only
+  // filters and projections sit between the scan and this Limit.
+  void publishRowBudget();
+
   int32_t remainingOffset_;
   int32_t remainingLimit_;
+
+  // True if the plan between the table scan and this Limit streams rows
+  // one-for-one or narrows them, making the row budget sound.
+  const bool publishesRowBudget_;
+
   bool finished_{false};
 };
 } // namespace facebook::velox::exec
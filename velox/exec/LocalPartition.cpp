@@ -15,6 +15,10 @@
  */
 
 #include "velox/exec/LocalPartition.h"
+
+#include <limits>
+#include <numeric>
+
 #include "velox/exec/Task.h"
 
 namespace facebook::velox::exec {
@@ -85,7 +89,11 @@ void LocalExchangeQueue::noMoreProducers() {
 BlockingReason LocalExchangeQueue::enqueue(
     RowVectorPtr input,
     ContinueFuture* future) {
-  auto inputBytes = input->retainedSize();
+  // Deduplicated: the columns of a partition slice share one indices
+  // buffer, and wrapped columns can share base buffers, so plain
+  // retainedSize() would charge shared memory once per column and
+  // overstate queue usage.
+  auto inputBytes = input->deduplicatedRetainedSize();
 
   std::vector<ContinuePromise> consumerPromises;
   bool isClosed = queue_.withWLock([&](auto& queue) {
@@ -149,8 +157,8 @@ BlockingReason LocalExchangeQueue::next(
     *data = queue.front();
     queue.pop();
 
-    memoryPromises =
-        memoryManager_->decreaseMemoryUsage((*data)->retainedSize());
+    memoryPromises = memoryManager_->decreaseMemoryUsage(
+        (*data)->deduplicatedRetainedSize());
 
     if (noMoreProducers_ && pendingProducers_ == 0 && queue.empty()) {
       producerPromises = std::move(producerPromises_);
@@ -200,7 +208,7 @@ void LocalExchangeQueue::close() {
   queue_.withWLock([&](auto& queue) {
     uint64_t freedBytes = 0;
     while (!queue.empty()) {
-      freedBytes += queue.front()->retainedSize();
+      freedBytes += queue.front()->deduplicatedRetainedSize();
       queue.pop();
     }
 
@@ -280,6 +288,9 @@ LocalPartition::LocalPartition(
           numPartitions_ == 1
               ? nullptr
               : planNode->partitionFunctionFactory()(numPartitions_)),
+      mayRebalanceSkew_{
+          planNode->mayRebalanceSkew() &&
+          planNode->type() == core::LocalPartitionNode::Type::kRepartition},
       blockingReasons_{numPartitions_} {
   VELOX_CHECK(numPartitions_ == 1 || partitionFunction_ != nullptr);
 
@@ -360,6 +371,35 @@ void LocalPartition::addInput(RowVectorPtr input) {
       ++maxIndex[partition];
     }
 
+    // When the plan allows it, reroute slices destined for consumers whose
+    // queues backed up far beyond the least loaded sibling to that sibling
+    // instead. Partitioning then degrades toward round-robin for exactly
+    // the hot keys, which is safe only because the consumer declared
+    // itself insensitive to key co-location.
+    std::vector<uint32_t> targets;
+    int64_t rebalancedRows = 0;
+    if (mayRebalanceSkew_) {
+      targets.resize(numPartitions_);
+      std::iota(targets.begin(), targets.end(), 0);
+      std::vector<size_t> depths(numPartitions_);
+      size_t minDepth = std::numeric_limits<size_t>::max();
+      uint32_t minPartition = 0;
+      for (auto i = 0; i < numPartitions_; ++i) {
+        depths[i] = queues_[i]->queuedBatches();
+        if (depths[i] < minDepth) {
+          minDepth = depths[i];
+          minPartition = i;
+        }
+      }
+      for (auto i = 0; i < numPartitions_; ++i) {
+        if (maxIndex[i] > 0 && depths[i] >= kSkewMinQueuedBatches &&
+            depths[i] >= 2 * (minDepth + 1)) {
+          targets[i] = minPartition;
+          rebalancedRows += maxIndex[i];
+        }
+      }
+    }
+
     for (auto i = 0; i < numPartitions_; i++) {
       auto partitionSize = maxIndex[i];
       if (partitionSize == 0) {
@@ -371,13 +411,19 @@ void LocalPartition::addInput(RowVectorPtr input) {
           wrapChildren(input_, partitionSize, std::move(indexBuffers[i]));
 
       ContinueFuture future;
-      auto reason = queues_[i]->enqueue(partitionData, &future);
+      auto reason = queues_[mayRebalanceSkew_ ? targets[i] : i]->enqueue(
+          partitionData, &future);
       if (reason != BlockingReason::kNotBlocked) {
         blockingReasons_[numBlockedPartitions_] = reason;
         futures_[numBlockedPartitions_] = std::move(future);
         ++numBlockedPartitions_;
       }
     }
+
+    if (rebalancedRows > 0) {
+      stats_.addRuntimeStat(
+          "skewRebalancedRows", RuntimeCounter(rebalancedRows));
+    }
   }
 }
 
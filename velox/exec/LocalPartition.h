@@ -96,6 +96,12 @@ class LocalExchangeQueue {
   /// called before all the data has been processed. No-op otherwise.
   void close();
 
+  /// Returns the number of batches currently buffered. Used by producers
+  /// to detect skewed consumers.
+  size_t queuedBatches() const {
+    return queue_.rlock()->size();
+  }
+
  private:
   bool isFinishedLocked(const std::queue<RowVectorPtr>& queue) const;
 
@@ -191,10 +197,19 @@ class LocalPartition : public Operator {
   }
 
  private:
+  // A partition's queue must back up by at least this many batches before
+  // its rows may be rerouted to the least loaded sibling.
+  static constexpr size_t kSkewMinQueuedBatches = 8;
+
   const std::vector<std::shared_ptr<LocalExchangeQueue>> queues_;
   const size_t numPartitions_;
   std::unique_ptr<core::PartitionFunction> partitionFunction_;
 
+  // True if the plan declared the consumer insensitive to co-location of
+  // equal keys, allowing slices of backed-up partitions to be rerouted to
+  // idle ones. See LocalPartitionNode::mayRebalanceSkew().
+  const bool mayRebalanceSkew_;
+
   uint32_t numBlockedPartitions_{0};
   std::vector<BlockingReason> blockingReasons_;
   std::vector<ContinueFuture> futures_;
@@ -31,6 +31,7 @@
 #include "velox/exec/MergeJoin.h"
 #include "velox/exec/OrderBy.h"
 #include "velox/exec/PartitionedOutput.h"
+#include "velox/exec/Prefetch.h"
 #include "velox/exec/StreamingAggregation.h"
 #include "velox/exec/TableScan.h"
 #include "velox/exec/TableWriter.h"
@@ -365,6 +366,11 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
         auto limitNode =
             std::dynamic_pointer_cast<const core::LimitNode>(planNode)) {
       operators.push_back(std::make_unique<Limit>(id, ctx.get(), limitNode));
+    } else if (
+        auto prefetchNode =
+            std::dynamic_pointer_cast<const core::PrefetchNode>(planNode)) {
+      operators.push_back(
+          std::make_unique<Prefetch>(id, ctx.get(), prefetchNode));
     } else if (
         auto orderByNode =
             std::dynamic_pointer_cast<const core::OrderByNode>(planNode)) {
@@ -146,16 +146,37 @@ RowVectorPtr Merge::getOutput() {
       return std::move(output_);
     }
 
-    if (stream->setOutputRow(outputSize_)) {
-      // The stream is at end of input batch. Need to copy out the rows before
-      // fetching next batch in 'pop'.
-      stream->copyToOutput(output_);
+    // Transfer a whole sorted run: if no rows are buffered yet, the
+    // winner is at the start of its batch and the batch's last row still
+    // sorts before the runner-up, the batch passes through as-is with no
+    // row-by-row merging or copying.
+    if (outputSize_ == 0 && stream->isBatchStart()) {
+      auto* runnerUp = treeOfLosers_->runnerUpStream();
+      if (runnerUp == nullptr || stream->batchEndsBefore(*runnerUp)) {
+        return stream->releaseBatch(sourceBlockingFutures_);
+      }
     }
 
-    ++outputSize_;
+    // Emit a run from the winning stream: while its next value still
+    // sorts before the runner-up at the tree's root, keep consuming it
+    // without tree updates.
+    for (;;) {
+      if (stream->setOutputRow(outputSize_)) {
+        // The stream is at end of input batch. Need to copy out the rows
+        // before fetching next batch in 'pop'.
+        stream->copyToOutput(output_);
+      }
+
+      ++outputSize_;
 
-    // Advance the stream.
-    stream->pop(sourceBlockingFutures_);
+      // Advance the stream.
+      stream->pop(sourceBlockingFutures_);
+      if (outputSize_ == outputBatchSize_ ||
+          !sourceBlockingFutures_.empty() || !stream->hasData() ||
+          !treeOfLosers_->lastStreamStillFirst()) {
+        break;
+      }
+    }
 
     if (outputSize_ == outputBatchSize_) {
       // Copy out data from all sources.
@@ -199,6 +220,32 @@ bool SourceStream::operator<(const MergeStream& other) const {
   return false;
 }
 
+bool SourceStream::batchEndsBefore(const MergeStream& other) const {
+  const auto& otherCursor = static_cast<const SourceStream&>(other);
+  const auto lastRow = data_->size() - 1;
+  for (auto i = 0; i < sortingKeys_.size(); ++i) {
+    const auto& [_, compareFlags] = sortingKeys_[i];
+    if (auto result = keyColumns_[i]
+                          ->compare(
+                              otherCursor.keyColumns_[i],
+                              lastRow,
+                              otherCursor.currentSourceRow_,
+                              compareFlags)
+                          .value()) {
+      return result < 0;
+    }
+  }
+  return false;
+}
+
+RowVectorPtr SourceStream::releaseBatch(std::vector<ContinueFuture>& futures) {
+  VELOX_CHECK_EQ(currentSourceRow_, 0);
+  VELOX_CHECK(!outputRows_.hasSelections());
+  auto batch = std::move(data_);
+  fetchMoreData(futures);
+  return batch;
+}
+
 bool SourceStream::pop(std::vector<ContinueFuture>& futures) {
   ++currentSourceRow_;
   if (currentSourceRow_ == data_->size()) {
@@ -297,7 +344,10 @@ MergeExchange::MergeExchange(
           mergeExchangeNode->sortingKeys(),
           mergeExchangeNode->sortingOrders(),
           mergeExchangeNode->id(),
-          "MergeExchange") {}
+          "MergeExchange") {
+  serdeOptions_.compressionCodec =
+      driverCtx->queryConfig().exchangeCompressionCodec();
+}
 
 BlockingReason MergeExchange::addMergeSources(ContinueFuture* future) {
   if (operatorCtx_->driverCtx()->driverId != 0) {
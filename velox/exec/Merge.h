@@ -137,6 +137,22 @@ class SourceStream final : public MergeStream {
   /// output batch.
   void copyToOutput(RowVectorPtr& output);
 
+  /// True if positioned on the first row of the current batch with no rows
+  /// pending copy-out, so the batch may be transferred wholesale.
+  bool isBatchStart() const {
+    return currentSourceRow_ == 0 && firstSourceRow_ == 0;
+  }
+
+  /// Returns true if the last row of the current batch sorts before the
+  /// current row of 'other', i.e. the entire batch precedes everything
+  /// 'other' and the streams that lost to it can still produce.
+  bool batchEndsBefore(const MergeStream& other) const;
+
+  /// Transfers ownership of the current batch to the caller and starts
+  /// fetching the next one, appending a future to 'futures' if the source
+  /// needs to wait. The stream must be at the start of the batch.
+  RowVectorPtr releaseBatch(std::vector<ContinueFuture>& futures);
+
  private:
   bool fetchMoreData(std::vector<ContinueFuture>& futures);
 
@@ -195,12 +211,19 @@ class MergeExchange : public Merge {
       DriverCtx* driverCtx,
       const std::shared_ptr<const core::MergeExchangeNode>& orderByNode);
 
+  /// Serde options for reading pages, carrying the exchange
+  /// compression codec from the query config.
+  const VectorSerde::Options* serdeOptions() const {
+    return &serdeOptions_;
+  }
+
  protected:
   BlockingReason addMergeSources(ContinueFuture* future) override;
 
  private:
   bool noMoreSplits_ = false;
   size_t numSplits_{0}; // Number of splits we took to process so far.
+  VectorSerde::Options serdeOptions_;
 };
 
 } // namespace facebook::velox::exec
@@ -169,10 +169,32 @@ bool MergeJoin::findEndOfMatch(
 
   auto numInput = input->size();
 
+  // The input is sorted, so rows matching the key form a prefix.
+  // Gallop to the end of the run and binary search the boundary
+  // instead of comparing one row at a time: O(log(run)) comparisons
+  // for long equal-key runs.
   vector_size_t endIndex = 0;
-  while (endIndex < numInput &&
-         compare(keys, input, endIndex, keys, prevInput, prevIndex) == 0) {
-    ++endIndex;
+  if (numInput > 0 &&
+      compare(keys, input, 0, keys, prevInput, prevIndex) == 0) {
+    vector_size_t lastEqual = 0;
+    vector_size_t step = 1;
+    while (lastEqual + step < numInput &&
+           compare(keys, input, lastEqual + step, keys, prevInput, prevIndex) ==
+               0) {
+      lastEqual += step;
+      step *= 2;
+    }
+    vector_size_t firstGreater =
+        std::min<vector_size_t>(numInput, lastEqual + step);
+    while (lastEqual + 1 < firstGreater) {
+      const auto middle = lastEqual + (firstGreater - lastEqual) / 2;
+      if (compare(keys, input, middle, keys, prevInput, prevIndex) == 0) {
+        lastEqual = middle;
+      } else {
+        firstGreater = middle;
+      }
+    }
+    endIndex = firstGreater;
   }
 
   if (endIndex == numInput) {
@@ -155,7 +155,8 @@ class MergeExchangeSource : public MergeSource {
           inputStream_.get(),
           mergeExchange_->pool(),
           mergeExchange_->outputType(),
-          &data);
+          &data,
+          mergeExchange_->serdeOptions());
 
       mergeExchange_->stats().inputPositions += data->size();
       mergeExchange_->stats().inputBytes += data->retainedSize();
@@ -94,6 +94,10 @@ Operator::Operator(
           std::move(planNodeId),
           std::move(operatorType)),
       outputType_(std::move(outputType)) {
+  const auto& queryConfig = driverCtx->queryConfig();
+  preferredOutputBatchBytes_ = queryConfig.preferredOutputBatchBytes();
+  preferredOutputBatchRows_ = queryConfig.preferredOutputBatchSize();
+  maxOutputBatchRows_ = queryConfig.maxOutputBatchRows();
   auto memoryUsageTracker = pool()->getMemoryUsageTracker();
   if (memoryUsageTracker) {
     memoryUsageTracker->setMakeMemoryCapExceededMessage(
@@ -119,6 +123,18 @@ Operator::Operator(
           std::move(planNodeId),
           std::move(operatorType)) {}
 
+vector_size_t Operator::outputBatchRows(
+    std::optional<int64_t> averageRowSize) const {
+  if (!averageRowSize.has_value() || averageRowSize.value() <= 0) {
+    return preferredOutputBatchRows_;
+  }
+  return std::max<int64_t>(
+      1,
+      std::min<int64_t>(
+          maxOutputBatchRows_,
+          preferredOutputBatchBytes_ / averageRowSize.value()));
+}
+
 std::vector<std::unique_ptr<Operator::PlanNodeTranslator>>&
 Operator::translators() {
   static std::vector<std::unique_ptr<PlanNodeTranslator>> translators;
@@ -408,10 +408,25 @@ class Operator {
   // 'identityProjections_' and 'resultProjections_'.
   RowVectorPtr fillOutput(vector_size_t size, BufferPtr mapping);
 
+  /// Returns the number of rows to put in an output batch. When
+  /// 'averageRowSize' is known, targets 'preferred_output_batch_bytes'
+  /// of output, clamped to [1, 'max_output_batch_rows'], so that wide
+  /// rows produce fewer, cache-friendly batches and narrow rows
+  /// amortize per-batch overhead over more rows. Falls back to
+  /// 'preferred_output_batch_size' rows when the row size is unknown.
+  vector_size_t outputBatchRows(
+      std::optional<int64_t> averageRowSize = std::nullopt) const;
+
   std::unique_ptr<OperatorCtx> operatorCtx_;
   OperatorStats stats_;
   const RowTypePtr outputType_;
 
+  // Output batch sizing parameters, see outputBatchRows(). Initialized
+  // from the query config when the operator has a DriverCtx.
+  uint64_t preferredOutputBatchBytes_{10UL << 20};
+  vector_size_t preferredOutputBatchRows_{1024};
+  vector_size_t maxOutputBatchRows_{10'000};
+
   // Holds the last data from addInput until it is processed. Reset after the
   // input is processed.
   RowVectorPtr input_;
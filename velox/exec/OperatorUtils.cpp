@@ -14,7 +14,10 @@
  * limitations under the License.
  */
 
+#include <folly/String.h>
+
 #include "velox/exec/OperatorUtils.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/VectorHasher.h"
 #include "velox/expression/EvalCtx.h"
 #include "velox/vector/ConstantVector.h"
@@ -37,7 +40,7 @@ void scalarGatherCopy(
   using T = typename TypeTraits<kind>::NativeType;
   auto* flatVector = target->template asUnchecked<FlatVector<T>>();
   uint64_t* rawNulls = nullptr;
-  if (std::is_same_v<T, StringView>) {
+  if constexpr (std::is_same_v<T, StringView>) {
     for (int i = 0; i < count; ++i) {
       VELOX_DCHECK(!sources[i]->mayHaveNulls());
       if (sources[i]
@@ -56,6 +59,54 @@ void scalarGatherCopy(
               sourceIndices[i]));
       flatVector->acquireSharedStringBuffers(source);
     }
+  } else if constexpr (!std::is_same_v<T, bool>) {
+    // Process runs of rows coming from the same source vector so the
+    // source column is resolved once per run instead of once per row.
+    // Null-free flat runs copy through raw values, with a SIMD gather
+    // for 4 and 8 byte types.
+    T* rawValues = flatVector->mutableRawValues();
+    int32_t i = 0;
+    while (i < count) {
+      const auto* source = sources[i];
+      VELOX_DCHECK(!source->mayHaveNulls());
+      int32_t runEnd = i + 1;
+      while (runEnd < count && sources[runEnd] == source) {
+        ++runEnd;
+      }
+      const auto& child = source->childAt(sourceColumnChannel);
+      if (child->isFlatEncoding() && !child->mayHaveNulls()) {
+        const T* rawSource =
+            child->template asUnchecked<FlatVector<T>>()->rawValues();
+        int32_t row = i;
+        if constexpr (
+            std::is_arithmetic_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) {
+          constexpr int32_t kWidth = xsimd::batch<T>::size;
+          for (; row + kWidth <= runEnd; row += kWidth) {
+            simd::gather<T, vector_size_t>(
+                rawSource, sourceIndices.data() + row)
+                .store_unaligned(rawValues + targetIndex + row);
+          }
+        }
+        for (; row < runEnd; ++row) {
+          rawValues[targetIndex + row] = rawSource[sourceIndices[row]];
+        }
+      } else {
+        for (auto row = i; row < runEnd; ++row) {
+          if (child->isNullAt(sourceIndices[row])) {
+            if (FOLLY_UNLIKELY(rawNulls == nullptr)) {
+              rawNulls = target->mutableRawNulls();
+            }
+            bits::setNull(rawNulls, targetIndex + row, true);
+            continue;
+          }
+          flatVector->set(
+              targetIndex + row,
+              child->template asUnchecked<FlatVector<T>>()->valueAt(
+                  sourceIndices[row]));
+        }
+      }
+      i = runEnd;
+    }
   } else {
     for (int i = 0; i < count; ++i) {
       VELOX_DCHECK(!sources[i]->mayHaveNulls());
@@ -341,7 +392,18 @@ std::string makeOperatorSpillPath(
     int driverId,
     int32_t operatorId) {
   VELOX_CHECK(!spillPath.empty());
-  return fmt::format("{}/{}_{}_{}", spillPath, taskId, driverId, operatorId);
+  // 'spillPath' may be a comma separated list of directories, e.g. one
+  // per local drive. Concurrent spilling operators spread across the
+  // entries by hashing their identity, so co-running tasks stripe over
+  // the drives instead of saturating one.
+  std::vector<std::string> paths;
+  folly::split(',', spillPath, paths, /*ignoreEmpty=*/true);
+  VELOX_CHECK(!paths.empty(), "Invalid spill path: {}", spillPath);
+  const auto index = paths.size() == 1
+      ? 0
+      : (std::hash<std::string>()(taskId) + driverId * 31 + operatorId) %
+          paths.size();
+  return fmt::format("{}/{}_{}_{}", paths[index], taskId, driverId, operatorId);
 }
 
 std::optional<Spiller::Config> makeOperatorSpillConfig(
@@ -371,7 +433,8 @@ std::optional<Spiller::Config> makeOperatorSpillConfig(
           queryConfig.spillStartPartitionBit(),
           queryConfig.spillStartPartitionBit() +
               queryConfig.spillPartitionBits()),
-      queryConfig.testingSpillPct());
+      queryConfig.testingSpillPct(),
+      queryConfig.spillCompressionCodec());
 }
 
 } // namespace facebook::velox::exec
@@ -124,4 +124,111 @@ std::optional<Spiller::Config> makeOperatorSpillConfig(
     const char* spillConfigPropertyName,
     int32_t operatorId);
 
+/// Order-preserving encodings of sort key values into uint64: a sorting
+/// before b implies encode(a) <= encode(b), with full comparison
+/// breaking prefix ties. Used by sorting operators to resolve most
+/// comparisons with one integer compare.
+inline uint64_t encodeSortPrefixSigned(int64_t value) {
+  return static_cast<uint64_t>(value) ^ (1ULL << 63);
+}
+
+inline uint64_t encodeSortPrefixDoubleBits(uint64_t bits) {
+  return (bits & (1ULL << 63)) ? ~bits : (bits | (1ULL << 63));
+}
+
+inline uint64_t encodeSortPrefixFloatBits(uint32_t bits) {
+  const uint32_t encoded = (bits & (1U << 31)) ? ~bits : (bits | (1U << 31));
+  return static_cast<uint64_t>(encoded) << 32;
+}
+
+inline uint64_t encodeSortPrefixString(const StringView& value) {
+  uint64_t prefix = 0;
+  std::memcpy(&prefix, value.data(), std::min<uint32_t>(8, value.size()));
+  return __builtin_bswap64(prefix);
+}
+
+/// Encodes the value of 'kind' stored at 'valuePtr' (RowContainer row
+/// layout) into 'prefix'. Returns false for kinds without an encoding.
+inline bool
+encodeSortKeyPrefix(TypeKind kind, const char* valuePtr, uint64_t& prefix) {
+  switch (kind) {
+    case TypeKind::TINYINT:
+      prefix = encodeSortPrefixSigned(*reinterpret_cast<const int8_t*>(valuePtr));
+      return true;
+    case TypeKind::SMALLINT:
+      prefix =
+          encodeSortPrefixSigned(*reinterpret_cast<const int16_t*>(valuePtr));
+      return true;
+    case TypeKind::INTEGER:
+    case TypeKind::DATE:
+      prefix =
+          encodeSortPrefixSigned(*reinterpret_cast<const int32_t*>(valuePtr));
+      return true;
+    case TypeKind::BIGINT:
+      prefix =
+          encodeSortPrefixSigned(*reinterpret_cast<const int64_t*>(valuePtr));
+      return true;
+    case TypeKind::REAL:
+      prefix = encodeSortPrefixFloatBits(
+          *reinterpret_cast<const uint32_t*>(valuePtr));
+      return true;
+    case TypeKind::DOUBLE:
+      prefix = encodeSortPrefixDoubleBits(
+          *reinterpret_cast<const uint64_t*>(valuePtr));
+      return true;
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      prefix = encodeSortPrefixString(
+          *reinterpret_cast<const StringView*>(valuePtr));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Same as above for a decoded vector position.
+inline bool encodeSortKeyPrefix(
+    TypeKind kind,
+    const DecodedVector& decoded,
+    vector_size_t row,
+    uint64_t& prefix) {
+  switch (kind) {
+    case TypeKind::TINYINT:
+      prefix = encodeSortPrefixSigned(decoded.valueAt<int8_t>(row));
+      return true;
+    case TypeKind::SMALLINT:
+      prefix = encodeSortPrefixSigned(decoded.valueAt<int16_t>(row));
+      return true;
+    case TypeKind::INTEGER:
+      prefix = encodeSortPrefixSigned(decoded.valueAt<int32_t>(row));
+      return true;
+    case TypeKind::DATE:
+      prefix = encodeSortPrefixSigned(decoded.valueAt<Date>(row).days());
+      return true;
+    case TypeKind::BIGINT:
+      prefix = encodeSortPrefixSigned(decoded.valueAt<int64_t>(row));
+      return true;
+    case TypeKind::REAL: {
+      const float value = decoded.valueAt<float>(row);
+      uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      prefix = encodeSortPrefixFloatBits(bits);
+      return true;
+    }
+    case TypeKind::DOUBLE: {
+      const double value = decoded.valueAt<double>(row);
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      prefix = encodeSortPrefixDoubleBits(bits);
+      return true;
+    }
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      prefix = encodeSortPrefixString(decoded.valueAt<StringView>(row));
+      return true;
+    default:
+      return false;
+  }
+}
+
 } // namespace facebook::velox::exec
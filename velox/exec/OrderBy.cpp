@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 #include "velox/exec/OrderBy.h"
+
+#include <cstring>
+
+#include "velox/exec/Driver.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/vector/FlatVector.h"
@@ -94,9 +98,11 @@ OrderBy::OrderBy(
   }
 #endif
 
+  // Initial estimate from the fixed row width; refined in noMoreInput()
+  // once the average row size including variable length data is known.
   outputBatchSize_ = std::max<uint32_t>(
-      operatorCtx_->execCtx()->queryCtx()->config().preferredOutputBatchSize(),
-      data_->estimatedNumRowsPerBatch(kBatchSizeInBytes));
+      preferredOutputBatchRows_,
+      data_->estimatedNumRowsPerBatch(preferredOutputBatchBytes_));
 }
 
 void OrderBy::addInput(RowVectorPtr input) {
@@ -196,6 +202,9 @@ void OrderBy::ensureInputFits(const RowVectorPtr& input) {
   if (tracker->maybeReserve(targetIncrementBytes)) {
     return;
   }
+  stats_.addRuntimeStat(
+      "memoryReservationFailures",
+      RuntimeCounter(targetIncrementBytes, RuntimeCounter::Unit::kBytes));
   const int64_t rowsToSpill = std::max<int64_t>(
       1, targetIncrementBytes / (data_->fixedRowSize() + outOfLineBytesPerRow));
   spill(
@@ -207,6 +216,7 @@ void OrderBy::ensureInputFits(const RowVectorPtr& input) {
 void OrderBy::spill(int64_t targetRows, int64_t targetBytes) {
   VELOX_CHECK_GE(targetRows, 0);
   VELOX_CHECK_GE(targetBytes, 0);
+  stats_.addRuntimeStat("numSpills", RuntimeCounter(1));
 
   if (spiller_ == nullptr) {
     VELOX_DCHECK(mappedMemory_->tracker() != nullptr);
@@ -223,7 +233,8 @@ void OrderBy::spill(int64_t targetRows, int64_t targetBytes) {
         spillConfig.filePath,
         spillFileSize,
         Spiller::spillPool(),
-        spillConfig.executor);
+        spillConfig.executor,
+        spillConfig.compressionCodec);
     VELOX_CHECK_EQ(spiller_->state().maxPartitions(), 1);
   }
   spiller_->spill(targetRows, targetBytes);
@@ -238,6 +249,10 @@ void OrderBy::noMoreInput() {
     return;
   }
 
+  // All input is in: size output batches from the measured average row
+  // size, including out-of-line string data.
+  outputBatchSize_ = outputBatchRows(data_->estimateRowSize());
+
   if (spiller_ == nullptr) {
     VELOX_CHECK_EQ(numRows_, data_->numRows());
     // Sort the pointers to the rows in RowContainer (data_) instead of sorting
@@ -245,18 +260,25 @@ void OrderBy::noMoreInput() {
     returningRows_.resize(numRows_);
     RowContainerIterator iter;
     data_->listRows(&iter, numRows_, returningRows_.data());
-    std::sort(
-        returningRows_.begin(),
-        returningRows_.end(),
-        [this](const char* leftRow, const char* rightRow) {
-          for (vector_size_t index = 0; index < numSortKeys_; ++index) {
-            if (auto result = data_->compare(
-                    leftRow, rightRow, index, keyCompareFlags_[index])) {
-              return result < 0;
+    if (!trySortWithKeyPrefix()) {
+      size_t cancelCheckCounter = 0;
+      std::sort(
+          returningRows_.begin(),
+          returningRows_.end(),
+          [this, &cancelCheckCounter](
+              const char* leftRow, const char* rightRow) {
+            if (FOLLY_UNLIKELY((++cancelCheckCounter & 0xffff) == 0)) {
+              checkRunningDriverCancelled();
             }
-          }
-          return false;
-        });
+            for (vector_size_t index = 0; index < numSortKeys_; ++index) {
+              if (auto result = data_->compare(
+                      leftRow, rightRow, index, keyCompareFlags_[index])) {
+                return result < 0;
+              }
+            }
+            return false;
+          });
+    }
 
   } else {
     // Finish spill, and we shouldn't get any rows from non-spilled partition as
@@ -271,6 +293,76 @@ void OrderBy::noMoreInput() {
   }
 }
 
+bool OrderBy::trySortWithKeyPrefix() {
+  const auto& type = internalStoreType_->childAt(0);
+  const auto flags = keyCompareFlags_[0];
+  const auto column = data_->columnAt(0);
+  const auto offset = column.offset();
+  const auto nullByte = column.nullByte();
+  const auto nullMask = column.nullMask();
+
+  auto encodeValue = [&](const char* row, uint64_t& prefix) {
+    return encodeSortKeyPrefix(type->kind(), row + offset, prefix);
+  };
+
+  // Probe the encoder once before materializing prefixes.
+  {
+    uint64_t probe;
+    if (numRows_ == 0 || !encodeValue(returningRows_[0], probe)) {
+      return numRows_ == 0;
+    }
+  }
+
+  struct SortEntry {
+    uint64_t prefix;
+    const char* row;
+  };
+  // Lease the prefix array from the driver's scratch pool; sorts,
+  // spills and serializers in this driver reuse the same region.
+  ScratchPtr<SortEntry> entriesHolder(
+      operatorCtx_->driverCtx()->scratch, numRows_);
+  auto* entries = entriesHolder.get();
+  for (size_t i = 0; i < numRows_; ++i) {
+    const char* row = returningRows_[i];
+    uint64_t prefix;
+    if (row[nullByte] & nullMask) {
+      // Nulls get an extreme prefix; values encoding to the same
+      // extreme resolve through the full comparison.
+      prefix = flags.nullsFirst ? 0 : ~0ULL;
+    } else {
+      encodeValue(row, prefix);
+      if (!flags.ascending) {
+        prefix = ~prefix;
+      }
+    }
+    entries[i] = {prefix, row};
+  }
+  size_t cancelCheckCounter = 0;
+  std::sort(
+      entries,
+      entries + numRows_,
+      [this, &cancelCheckCounter](
+          const SortEntry& left, const SortEntry& right) {
+        if (FOLLY_UNLIKELY((++cancelCheckCounter & 0xffff) == 0)) {
+          checkRunningDriverCancelled();
+        }
+        if (left.prefix != right.prefix) {
+          return left.prefix < right.prefix;
+        }
+        for (vector_size_t index = 0; index < numSortKeys_; ++index) {
+          if (auto result = data_->compare(
+                  left.row, right.row, index, keyCompareFlags_[index])) {
+            return result < 0;
+          }
+        }
+        return false;
+      });
+  for (size_t i = 0; i < numRows_; ++i) {
+    returningRows_[i] = entries[i].row;
+  }
+  return true;
+}
+
 RowVectorPtr OrderBy::getOutput() {
   if (finished_ || !noMoreInput_ || numRows_ == numRowsReturned_) {
     return nullptr;
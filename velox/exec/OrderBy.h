@@ -57,7 +57,12 @@ class OrderBy : public Operator {
   }
 
  private:
-  static const int32_t kBatchSizeInBytes{2 * 1024 * 1024};
+  // Sorts 'returningRows_' comparing an order-preserving 64-bit prefix
+  // of the first sort key before falling back to the full per-column
+  // comparator, so most comparisons are one integer compare. Returns
+  // false if the first key type has no prefix encoding, in which case
+  // the caller sorts with the full comparator only.
+  bool trySortWithKeyPrefix();
 
   // Checks if input will fit in the existing memory and increases
   // reservation if not. If reservation cannot be increased, spills enough to
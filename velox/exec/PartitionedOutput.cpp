@@ -36,6 +36,28 @@ BlockingReason Destination::advance(
   if (bytesInCurrent_ >= adjustedMaxBytes) {
     return flush(bufferManager, future);
   }
+
+  // With nothing buffered and all columns constant, the whole remaining
+  // share of this destination goes out as one RLE page: a single value
+  // per column plus the row count, independent of data volume.
+  if (!currentHasTree_) {
+    bool allConstant = true;
+    for (auto i = 0; i < output->childrenSize(); ++i) {
+      if (!output->childAt(i)->isConstantEncoding()) {
+        allConstant = false;
+        break;
+      }
+    }
+    if (allConstant) {
+      bool flushed = false;
+      auto reason = tryFlushRlePage(output, bufferManager, future, flushed);
+      if (flushed) {
+        *atEnd = true;
+        return reason;
+      }
+    }
+  }
+
   auto firstRow = row_;
   for (; row_ < rows_.size(); ++row_) {
     // TODO Add support for serializing partial ranges if
@@ -58,18 +80,69 @@ BlockingReason Destination::advance(
   return BlockingReason::kNotBlocked;
 }
 
+BlockingReason Destination::tryFlushRlePage(
+    const RowVectorPtr& output,
+    PartitionedOutputBufferManager& bufferManager,
+    ContinueFuture* future,
+    bool& flushed) {
+  flushed = false;
+  vector_size_t numRows = 0;
+  for (auto i = row_; i < rows_.size(); ++i) {
+    numRows += rows_[i].size;
+  }
+  if (numRows == 0) {
+    return BlockingReason::kNotBlocked;
+  }
+  if (!current_) {
+    current_ = std::make_unique<VectorStreamGroup>(memory_);
+  }
+  auto rowType = std::dynamic_pointer_cast<const RowType>(output->type());
+  current_->createStreamTree(rowType, 1, serdeOptions_);
+
+  std::vector<VectorPtr> children(output->childrenSize());
+  for (auto i = 0; i < children.size(); ++i) {
+    children[i] = BaseVector::wrapInConstant(numRows, 0, output->childAt(i));
+  }
+  auto rleVector = std::make_shared<RowVector>(
+      output->pool(), output->type(), nullptr, numRows, std::move(children));
+
+  constexpr int32_t kMinMessageSize = 128;
+  auto listener = bufferManager.newListener();
+  IOBufOutputStream stream(
+      *current_->mappedMemory(), listener.get(), kMinMessageSize);
+  if (!current_->flushRlePage(rleVector, &stream)) {
+    // The serde has no RLE page representation; take the row path.
+    current_->clear();
+    return BlockingReason::kNotBlocked;
+  }
+  current_->clear();
+  currentHasTree_ = false;
+  bytesInCurrent_ = 0;
+  setTargetSizePct();
+  row_ = rows_.size();
+  flushed = true;
+  return bufferManager.enqueue(
+      taskId_,
+      destination_,
+      std::make_unique<SerializedPage>(stream.getIOBuf()),
+      future);
+}
+
 void Destination::serialize(
     const RowVectorPtr& output,
     vector_size_t begin,
     vector_size_t end) {
   if (!current_) {
     current_ = std::make_unique<VectorStreamGroup>(memory_);
+  }
+  if (!currentHasTree_) {
     auto rowType = std::dynamic_pointer_cast<const RowType>(output->type());
     vector_size_t numRows = 0;
     for (vector_size_t i = begin; i < end; i++) {
       numRows += rows_[i].size;
     }
-    current_->createStreamTree(rowType, numRows);
+    current_->createStreamTree(rowType, numRows, serdeOptions_);
+    currentHasTree_ = true;
   }
   current_->append(output, folly::Range(&rows_[begin], end - begin));
 }
@@ -77,7 +150,7 @@ void Destination::serialize(
 BlockingReason Destination::flush(
     PartitionedOutputBufferManager& bufferManager,
     ContinueFuture* future) {
-  if (!current_) {
+  if (!current_ || !currentHasTree_) {
     return BlockingReason::kNotBlocked;
   }
   // Upper limit of message size with no columns.
@@ -88,7 +161,10 @@ BlockingReason Destination::flush(
       listener.get(),
       std::max<int64_t>(kMinMessageSize, current_->size()));
   current_->flush(&stream);
-  current_.reset();
+  // Keep the stream group: its arena slabs serve the next batch for
+  // this destination.
+  current_->clear();
+  currentHasTree_ = false;
   bytesInCurrent_ = 0;
   setTargetSizePct();
 
@@ -125,7 +201,8 @@ void PartitionedOutput::initializeDestinations() {
     auto taskId = operatorCtx_->taskId();
     for (int i = 0; i < numDestinations_; ++i) {
       destinations_.push_back(
-          std::make_unique<Destination>(taskId, i, mappedMemory_));
+          std::make_unique<Destination>(
+              taskId, i, mappedMemory_, &serdeOptions_));
     }
   }
 }
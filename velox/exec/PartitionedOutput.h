@@ -27,8 +27,12 @@ class Destination {
   Destination(
       const std::string& taskId,
       int destination,
-      memory::MappedMemory* FOLLY_NONNULL memory)
-      : taskId_(taskId), destination_(destination), memory_(memory) {
+      memory::MappedMemory* FOLLY_NONNULL memory,
+      const VectorSerde::Options* FOLLY_NONNULL serdeOptions)
+      : taskId_(taskId),
+        destination_(destination),
+        memory_(memory),
+        serdeOptions_(serdeOptions) {
     setTargetSizePct();
   }
 
@@ -90,12 +94,30 @@ class Destination {
   const std::string taskId_;
   const int destination_;
   memory::MappedMemory* FOLLY_NONNULL const memory_;
+
+  // Serde options carrying the exchange compression codec, owned by
+  // the PartitionedOutput operator.
+  const VectorSerde::Options* FOLLY_NONNULL const serdeOptions_;
   uint64_t bytesInCurrent_{0};
   std::vector<IndexRange> rows_;
 
   // First row of 'rows_' that is not appended to 'current_'
   vector_size_t row_{0};
+  // Sends the destination's remaining rows of an all-constant 'output'
+  // as one RLE page when the serde supports it; 'flushed' reports
+  // whether the page was sent.
+  BlockingReason tryFlushRlePage(
+      const RowVectorPtr& output,
+      PartitionedOutputBufferManager& bufferManager,
+      ContinueFuture* future,
+      bool& flushed);
+
   std::unique_ptr<VectorStreamGroup> current_;
+
+  // True if 'current_' holds a stream tree with data appended since
+  // the last flush. 'current_' itself persists across flushes to keep
+  // its arena slabs.
+  bool currentHasTree_{false};
   bool finished_{false};
 
   // Flush accumulated data to buffer manager after reaching this
@@ -151,6 +173,8 @@ class PartitionedOutput : public Operator {
         maxBufferedBytes_(
             ctx->task->queryCtx()->config().maxPartitionedOutputBufferSize()),
         mappedMemory_{operatorCtx_->mappedMemory()} {
+    serdeOptions_.compressionCodec =
+        ctx->queryConfig().exchangeCompressionCodec();
     if (numDestinations_ == 1 || planNode->isBroadcast()) {
       VELOX_CHECK(keyChannels_.empty());
       VELOX_CHECK_NULL(partitionFunction_);
@@ -217,6 +241,10 @@ class PartitionedOutput : public Operator {
   std::weak_ptr<exec::PartitionedOutputBufferManager> bufferManager_;
   const int64_t maxBufferedBytes_;
   memory::MappedMemory* FOLLY_NONNULL mappedMemory_;
+
+  // Serde options carrying the exchange compression codec, shared by
+  // all destinations.
+  VectorSerde::Options serdeOptions_;
   RowVectorPtr output_;
 
   // Reusable memory.
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/Prefetch.h"
+#include "velox/exec/Task.h"
+
+namespace facebook::velox::exec {
+
+Prefetch::Prefetch(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    const std::shared_ptr<const core::PrefetchNode>& prefetchNode)
+    : Operator(
+          driverCtx,
+          prefetchNode->outputType(),
+          operatorId,
+          prefetchNode->id(),
+          "Prefetch"),
+      numBatches_(prefetchNode->numBatches()),
+      executor_(
+          operatorCtx_->task()->queryCtx()->isExecutorSupplied()
+              ? operatorCtx_->task()->queryCtx()->executor()
+              : nullptr) {}
+
+void Prefetch::addInput(RowVectorPtr input) {
+  auto source =
+      std::make_shared<AsyncSource<RowVectorPtr>>([input]() mutable {
+        for (auto& child : input->children()) {
+          child = BaseVector::loadedVectorShared(child);
+        }
+        return std::make_unique<RowVectorPtr>(std::move(input));
+      });
+  if (executor_ != nullptr) {
+    executor_->add([source]() { source->prepare(); });
+  }
+  queue_.push_back(std::move(source));
+}
+
+RowVectorPtr Prefetch::getOutput() {
+  if (queue_.empty()) {
+    return nullptr;
+  }
+  auto source = std::move(queue_.front());
+  queue_.pop_front();
+  // Waits for the load if it is in progress on the executor, otherwise
+  // loads on this thread.
+  auto result = source->move();
+  return std::move(*result);
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <deque>
+
+#include "velox/common/base/AsyncSource.h"
+#include "velox/exec/Operator.h"
+
+namespace facebook::velox::exec {
+
+/// Buffers up to 'numBatches' input batches and loads their lazy
+/// columns on the Task's executor while the Driver runs downstream
+/// operators, overlapping scan I/O and decode with downstream CPU.
+/// Batches come out in input order. Without a Task executor the columns
+/// are loaded on the Driver thread when a batch is taken out, making
+/// the operator a plain bounded reorder-free buffer.
+class Prefetch : public Operator {
+ public:
+  Prefetch(
+      int32_t operatorId,
+      DriverCtx* FOLLY_NONNULL driverCtx,
+      const std::shared_ptr<const core::PrefetchNode>& prefetchNode);
+
+  bool needsInput() const override {
+    // Do not accept more input until the last batch's lazy columns are
+    // loaded. Lazy vectors must be loaded before the producing reader
+    // moves on to the next batch (see dwio::common::ColumnLoader), so
+    // at most one load is in flight while loaded batches drain
+    // downstream.
+    return !noMoreInput_ && queue_.size() < numBatches_ &&
+        (queue_.empty() || queue_.back()->hasValue());
+  }
+
+  void addInput(RowVectorPtr input) override;
+
+  RowVectorPtr getOutput() override;
+
+  BlockingReason isBlocked(ContinueFuture* /*future*/) override {
+    return BlockingReason::kNotBlocked;
+  }
+
+  bool isFinished() override {
+    return noMoreInput_ && queue_.empty();
+  }
+
+ private:
+  const int32_t numBatches_;
+
+  // Executor loading batches ahead, nullptr in single-threaded
+  // execution.
+  folly::Executor* FOLLY_NULLABLE const executor_;
+
+  // Batches in input order with loading possibly in progress.
+  std::deque<std::shared_ptr<AsyncSource<RowVectorPtr>>> queue_;
+};
+
+} // namespace facebook::velox::exec
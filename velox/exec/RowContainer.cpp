@@ -55,7 +55,8 @@ RowContainer::RowContainer(
     bool hasProbedFlag,
     bool hasNormalizedKeys,
     memory::MappedMemory* mappedMemory,
-    const RowSerde& serde)
+    const RowSerde& serde,
+    bool columnarAccumulators)
     : keyTypes_(keyTypes),
       nullableKeys_(nullableKeys),
       aggregates_(aggregates),
@@ -64,6 +65,10 @@ RowContainer::RowContainer(
       rows_(mappedMemory),
       stringAllocator_(mappedMemory),
       serde_(serde) {
+  // Values serialized by storeComplexType and the accumulators are
+  // carved from a reserved run instead of a free-list round trip per
+  // value. Erased values go back to the free list individually.
+  stringAllocator_.setBumpAllocation(true);
   // Compute the layout of the payload row.  The row has keys, null
   // flags, accumulators, dependent fields. All fields are fixed
   // width. If variable width data is referenced, this is done with
@@ -108,15 +113,54 @@ RowContainer::RowContainer(
   offset = std::max<int32_t>(offset, sizeof(void*));
   int32_t firstAggregate = offsets_.size();
   int32_t firstAggregateOffset = offset;
-  for (auto& aggregate : aggregates) {
-    // Accumulator offset must be aligned by their alignment size.
-    offset = bits::roundUp(offset, aggregate->accumulatorAlignmentSize());
-    offsets_.push_back(offset);
-    offset += aggregate->accumulatorFixedWidthSize();
-    nullOffsets_.push_back(nullOffset);
-    ++nullOffset;
-    isVariableWidth |= !aggregate->isFixedSize();
-    usesExternalMemory_ |= aggregate->accumulatorUsesExternalMemory();
+  if (columnarAccumulators && !aggregates.empty()) {
+    // Columnar layout applies only if every accumulator is fixed-width
+    // and self-contained, so that no Aggregate keeps out-of-line state
+    // or needs destruction through the row pointer.
+    columnarAccumulators_ = true;
+    for (auto& aggregate : aggregates) {
+      if (!aggregate->isFixedSize() ||
+          aggregate->accumulatorUsesExternalMemory()) {
+        columnarAccumulators_ = false;
+        break;
+      }
+    }
+  }
+  if (columnarAccumulators_) {
+    // Accumulators live in per-aggregate contiguous arrays indexed by a
+    // dense row id; the row holds only the id. Each array element is a
+    // null byte followed by the accumulator at its required alignment.
+    // The aggregates' offsets are set relative to the element below.
+    for (auto& aggregate : aggregates) {
+      AccumulatorColumn column;
+      // Align elements at least to 8 bytes so that word-sized
+      // accumulators never straddle cache lines.
+      const auto alignment = std::max<int32_t>(
+          aggregate->accumulatorAlignmentSize(), sizeof(uint64_t));
+      column.valueOffset = bits::roundUp(1, alignment);
+      column.stride = bits::roundUp(
+          column.valueOffset + aggregate->accumulatorFixedWidthSize(),
+          alignment);
+      accumulatorColumns_.push_back(std::move(column));
+      // Keep per-aggregate entries in 'offsets_'/'nullOffsets_' so that
+      // column indexing stays uniform; the offset points at the row id.
+      offsets_.push_back(offset);
+      nullOffsets_.push_back(nullOffset);
+      ++nullOffset;
+    }
+    rowIdOffset_ = offset;
+    offset += sizeof(uint32_t);
+  } else {
+    for (auto& aggregate : aggregates) {
+      // Accumulator offset must be aligned by their alignment size.
+      offset = bits::roundUp(offset, aggregate->accumulatorAlignmentSize());
+      offsets_.push_back(offset);
+      offset += aggregate->accumulatorFixedWidthSize();
+      nullOffsets_.push_back(nullOffset);
+      ++nullOffset;
+      isVariableWidth |= !aggregate->isFixedSize();
+      usesExternalMemory_ |= aggregate->accumulatorUsesExternalMemory();
+    }
   }
   for (auto& type : dependentTypes) {
     types_.push_back(type);
@@ -127,6 +171,21 @@ RowContainer::RowContainer(
     ++nullOffset;
     isVariableWidth |= !type->isFixedWidth();
   }
+  // Bind a typed comparator to each column once, so that per-row
+  // compare() calls in sort and merge loops skip the TypeKind dispatch.
+  // Kinds without a comparator, e.g. UNKNOWN, get nullptr; compare()
+  // then falls back to per-call dispatch, which fails only if invoked.
+  columnCompare_.reserve(types_.size());
+  for (auto& type : types_) {
+    const auto kind = type->kind();
+    if (kind == TypeKind::UNKNOWN || kind == TypeKind::FUNCTION ||
+        kind == TypeKind::OPAQUE || kind == TypeKind::INVALID) {
+      columnCompare_.push_back(nullptr);
+    } else {
+      columnCompare_.push_back(
+          VELOX_DYNAMIC_TYPE_DISPATCH(getColumnCompare, kind));
+    }
+  }
   if (isVariableWidth) {
     rowSizeOffset_ = offset;
     offset += sizeof(uint32_t);
@@ -156,13 +215,24 @@ RowContainer::RowContainer(
     nullOffset = nullOffsets_[i + firstAggregate];
     if (i < aggregates.size()) {
       aggregates_[i]->setAllocator(&stringAllocator_);
-      aggregates_[i]->setOffsets(
-          offsets_[i + firstAggregate],
-          nullByte(nullOffset),
-          nullMask(nullOffset),
-          rowSizeOffset_);
+      if (columnarAccumulators_) {
+        // Offsets are relative to the accumulator array element: null
+        // byte first, value at its alignment. Fixed-size accumulators
+        // need no row size offset.
+        aggregates_[i]->setOffsets(
+            accumulatorColumns_[i].valueOffset, 0, 1, 0);
+      } else {
+        aggregates_[i]->setOffsets(
+            offsets_[i + firstAggregate],
+            nullByte(nullOffset),
+            nullMask(nullOffset),
+            rowSizeOffset_);
+      }
     }
   }
+  if (columnarAccumulators_) {
+    rowIdOffset_ += nullBytes;
+  }
   if (hasNext) {
     nextOffset_ = offset + nullBytes;
     offset += sizeof(void*);
@@ -226,9 +296,44 @@ char* RowContainer::initializeRow(char* row, bool reuse) {
   if (rowSizeOffset_) {
     variableRowSize(row) = 0;
   }
+  if (columnarAccumulators_) {
+    // Ids are not reused on row reuse so that accumulator elements of
+    // erased rows are never aliased.
+    ensureAccumulatorCapacity(nextRowId_ + 1);
+    valueAt<uint32_t>(row, rowIdOffset_) = nextRowId_++;
+  }
   return row;
 }
 
+void RowContainer::ensureAccumulatorCapacity(uint32_t numRows) {
+  if (numRows <= accumulatorCapacity_) {
+    return;
+  }
+  auto newCapacity = std::max<uint32_t>(
+      std::max<uint32_t>(accumulatorCapacity_ * 2, 1024), numRows);
+  constexpr auto kPageSize = memory::MappedMemory::kPageSize;
+  for (auto& column : accumulatorColumns_) {
+    memory::MappedMemory::ContiguousAllocation newData;
+    auto numPages = bits::roundUp(
+                        static_cast<uint64_t>(newCapacity) * column.stride,
+                        kPageSize) /
+        kPageSize;
+    if (!rows_.mappedMemory()->allocateContiguous(numPages, nullptr, newData)) {
+      VELOX_FAIL("Could not allocate columnar accumulator storage");
+    }
+    if (column.data.data<char>() != nullptr) {
+      memcpy(
+          newData.data<char>(),
+          column.data.data<char>(),
+          static_cast<uint64_t>(accumulatorCapacity_) * column.stride);
+      rows_.mappedMemory()->freeContiguous(column.data);
+    }
+    column.data.reset(newData.mappedMemory(), newData.data(), newData.size());
+    newData.reset(nullptr, nullptr, 0);
+  }
+  accumulatorCapacity_ = newCapacity;
+}
+
 void RowContainer::eraseRows(folly::Range<char**> rows) {
   freeVariableWidthFields(rows);
   freeAggregates(rows);
@@ -514,6 +619,8 @@ void RowContainer::clear() {
   }
   numFreeRows_ = 0;
   firstFreeRow_ = nullptr;
+  // Restart dense row ids; the accumulator arrays are kept for reuse.
+  nextRowId_ = 0;
 }
 
 void RowContainer::setProbedFlag(char** rows, int32_t numRows) {
@@ -170,6 +170,11 @@ class RowContainer {
   // into one word for faster comparison. The bulk allocation is done
   // from 'mappedMemory'.  'serde_' is used for serializing complex
   // type values into the container.
+  /// 'columnarAccumulators' requests the columnar accumulator layout:
+  /// accumulators live in per-aggregate contiguous arrays indexed by a
+  /// dense row id stored in the row instead of inline in the row. Applied
+  /// only if all accumulators are fixed-width and use no external memory,
+  /// otherwise the row-wise layout is used. See columnarAccumulators().
   RowContainer(
       const std::vector<TypePtr>& keyTypes,
       bool nullableKeys,
@@ -180,7 +185,8 @@ class RowContainer {
       bool hasProbedFlag,
       bool hasNormalizedKey,
       memory::MappedMemory* FOLLY_NONNULL mappedMemory,
-      const RowSerde& serde);
+      const RowSerde& serde,
+      bool columnarAccumulators = false);
 
   // Allocates a new row and initializes possible aggregates to null.
   char* FOLLY_NONNULL newRow();
@@ -197,6 +203,19 @@ class RowContainer {
     return fixedRowSize_;
   }
 
+  /// Returns the average size of the contained rows, including
+  /// out-of-line variable length data, or std::nullopt if the container
+  /// is empty.
+  std::optional<int64_t> estimateRowSize() const {
+    if (numRows_ == 0) {
+      return std::nullopt;
+    }
+    const auto outOfLineFreeBytes = stringAllocator_.freeSpace();
+    const auto outOfLineBytes =
+        stringAllocator_.retainedSize() - outOfLineFreeBytes;
+    return fixedRowSize_ + outOfLineBytes / numRows_;
+  }
+
   // Adds 'rows' to the free rows list and frees any associated
   // variable length data.
   void eraseRows(folly::Range<char**> rows);
@@ -500,7 +519,12 @@ class RowContainer {
       uint64_t* FOLLY_NONNULL result);
 
   uint64_t allocatedBytes() const {
-    return rows_.allocatedBytes() + stringAllocator_.retainedSize();
+    uint64_t accumulatorBytes = 0;
+    for (const auto& column : accumulatorColumns_) {
+      accumulatorBytes += column.data.size();
+    }
+    return rows_.allocatedBytes() + stringAllocator_.retainedSize() +
+        accumulatorBytes;
   }
 
   // Returns the number of fixed size rows that can be allocated
@@ -574,6 +598,33 @@ class RowContainer {
     return aggregates_;
   }
 
+  /// True if accumulators are stored in per-aggregate contiguous arrays
+  /// indexed by a dense row id instead of inline in the rows. In this
+  /// mode the aggregates' offsets are relative to the array element, so
+  /// callers must translate row pointers with accumulatorPointers()
+  /// before passing groups to any Aggregate method.
+  bool columnarAccumulators() const {
+    return columnarAccumulators_;
+  }
+
+  /// Writes to 'result[i]' the pointer to the accumulator element of
+  /// 'aggregateIndex' for the row 'rows[i]'. Valid only with
+  /// columnarAccumulators(). The pointers stay valid until the next
+  /// newRow() since adding rows may grow the arrays.
+  void accumulatorPointers(
+      int32_t aggregateIndex,
+      const char* FOLLY_NONNULL const* FOLLY_NONNULL rows,
+      int32_t numRows,
+      char* FOLLY_NONNULL* FOLLY_NONNULL result) const {
+    VELOX_DCHECK(columnarAccumulators_);
+    const auto& accumulator = accumulatorColumns_[aggregateIndex];
+    auto* base = accumulator.data.data<char>();
+    for (auto i = 0; i < numRows; ++i) {
+      result[i] = base +
+          valueAt<uint32_t>(rows[i], rowIdOffset_) * accumulator.stride;
+    }
+  }
+
   auto numFreeRows() const {
     return numFreeRows_;
   }
@@ -857,6 +908,35 @@ class RowContainer {
     return decoded.valueAt<T>(index) == valueAt<T>(row, offset);
   }
 
+  // Signature of a per-column comparator bound to the column's TypeKind
+  // when the container is constructed. See 'columnCompare_'.
+  using ColumnCompare = int32_t (*)(
+      RowContainer* FOLLY_NONNULL container,
+      const char* FOLLY_NONNULL left,
+      const char* FOLLY_NONNULL right,
+      int32_t columnIndex,
+      CompareFlags flags);
+
+  template <TypeKind Kind>
+  static int32_t compareColumn(
+      RowContainer* FOLLY_NONNULL container,
+      const char* FOLLY_NONNULL left,
+      const char* FOLLY_NONNULL right,
+      int32_t columnIndex,
+      CompareFlags flags) {
+    return container->template compare<Kind>(
+        left,
+        right,
+        container->types_[columnIndex].get(),
+        container->columnAt(columnIndex),
+        flags);
+  }
+
+  template <TypeKind Kind>
+  static ColumnCompare getColumnCompare() {
+    return &compareColumn<Kind>;
+  }
+
   template <TypeKind Kind>
   inline int compare(
       const char* FOLLY_NONNULL row,
@@ -1023,6 +1103,9 @@ class RowContainer {
   // to 'typeKinds_' and 'rowColumns_'.
   std::vector<TypePtr> types_;
   std::vector<TypeKind> typeKinds_;
+  // Typed comparator per column in 'types_', bound once at construction
+  // so that per-row compare() calls skip the TypeKind dispatch.
+  std::vector<ColumnCompare> columnCompare_;
   const bool isJoinBuild_;
   int32_t nextOffset_ = 0;
   // Bit position of null bit  in the row. 0 if no null flag. Order is keys,
@@ -1058,6 +1141,37 @@ class RowContainer {
   char* FOLLY_NULLABLE firstFreeRow_ = nullptr;
   uint64_t numFreeRows_ = 0;
 
+  // Contiguous per-aggregate accumulator storage for the columnar
+  // accumulator layout. Each element is a null byte followed by the
+  // accumulator value at the alignment required by the aggregate.
+  struct AccumulatorColumn {
+    // Byte offset of the accumulator value within the element. The null
+    // byte is at offset 0.
+    int32_t valueOffset;
+    // Distance in bytes between consecutive elements.
+    int32_t stride;
+    memory::MappedMemory::ContiguousAllocation data;
+  };
+
+  // True if accumulators are stored columnar. See columnarAccumulators().
+  bool columnarAccumulators_ = false;
+
+  // Byte offset of the uint32_t dense row id in the row. Set only with
+  // 'columnarAccumulators_'.
+  int32_t rowIdOffset_ = 0;
+
+  // The dense row id to assign to the next new row. Not reused on erase,
+  // reset by clear().
+  uint32_t nextRowId_ = 0;
+
+  // Number of elements the accumulator columns have space for.
+  uint32_t accumulatorCapacity_ = 0;
+
+  std::vector<AccumulatorColumn> accumulatorColumns_;
+
+  // Grows the accumulator columns to hold at least 'numRows' elements.
+  void ensureAccumulatorCapacity(uint32_t numRows);
+
   AllocationPool rows_;
   HashStringAllocator stringAllocator_;
 
@@ -1221,6 +1335,11 @@ inline int RowContainer::compare(
     const char* FOLLY_NONNULL right,
     int columnIndex,
     CompareFlags flags) {
+  // The TypeKind switch is resolved once at construction; per-row calls
+  // go straight to the column's typed comparator.
+  if (auto compareFunc = columnCompare_[columnIndex]) {
+    return compareFunc(this, left, right, columnIndex, flags);
+  }
   auto type = types_[columnIndex].get();
   return VELOX_DYNAMIC_TYPE_DISPATCH(
       compare, type->kind(), left, right, type, columnAt(columnIndex), flags);
@@ -20,6 +20,26 @@
 
 namespace facebook::velox::exec {
 
+namespace {
+// Returns the codec for 'name', nullptr for uncompressed spilling.
+std::unique_ptr<folly::io::Codec> makeSpillCodec(const std::string& name) {
+  if (name.empty() || name == "none") {
+    return nullptr;
+  }
+  if (name == "zstd") {
+    return folly::io::getCodec(folly::io::CodecType::ZSTD);
+  }
+  if (name == "lz4") {
+    return folly::io::getCodec(folly::io::CodecType::LZ4);
+  }
+  if (name == "snappy") {
+    return folly::io::getCodec(folly::io::CodecType::SNAPPY);
+  }
+  VELOX_USER_FAIL("Unsupported spill compression codec: {}", name);
+}
+} // namespace
+
+
 // Spilling currently uses the default PrestoSerializer which by default
 // serializes timestamp with millisecond precision to maintain compatibility
 // with presto. Since velox's native timestamp implementation supports
@@ -71,14 +91,32 @@ void SpillFile::startRead() {
   auto buffer = AlignedBuffer::allocate<char>(
       std::min<uint64_t>(fileSize_, kMaxReadBufferSize), &pool_);
   input_ = std::make_unique<SpillInput>(std::move(file), std::move(buffer));
+  codec_ = makeSpillCodec(compressionCodec_);
 }
 
 bool SpillFile::nextBatch(RowVectorPtr& rowVector) {
   if (input_->atEnd()) {
     return false;
   }
+  if (codec_ == nullptr) {
+    VectorStreamGroup::read(
+        input_.get(), &pool_, type_, &rowVector, &kDefaultSerdeOptions);
+    return true;
+  }
+  // Compressed spilling frames each flushed batch as
+  // [compressed size][raw size][compressed bytes].
+  const auto compressedSize = input_->read<int32_t>();
+  const auto rawSize = input_->read<int32_t>();
+  compressedScratch_.resize(compressedSize);
+  input_->readBytes(compressedScratch_.data(), compressedSize);
+  const auto uncompressed = codec_->uncompress(compressedScratch_, rawSize);
+  ByteStream stream;
+  stream.resetInput({ByteRange{
+      reinterpret_cast<uint8_t*>(const_cast<char*>(uncompressed.data())),
+      static_cast<int32_t>(uncompressed.size()),
+      0}});
   VectorStreamGroup::read(
-      input_.get(), &pool_, type_, &rowVector, &kDefaultSerdeOptions);
+      &stream, &pool_, type_, &rowVector, &kDefaultSerdeOptions);
   return true;
 }
 
@@ -93,7 +131,8 @@ WriteFile& SpillFileList::currentOutput() {
         numSortingKeys_,
         sortCompareFlags_,
         fmt::format("{}-{}", path_, files_.size()),
-        pool_));
+        pool_,
+        compressionCodec_));
   }
   return files_.back()->output();
 }
@@ -105,6 +144,24 @@ void SpillFileList::flush() {
     batch_->flush(&out);
     batch_.reset();
     auto iobuf = out.getIOBuf();
+    if (!codecCreated_) {
+      codec_ = makeSpillCodec(compressionCodec_);
+      codecCreated_ = true;
+    }
+    if (codec_ != nullptr) {
+      const int32_t rawSize = iobuf->computeChainDataLength();
+      iobuf = codec_->compress(iobuf.get());
+      const int32_t compressedSize = iobuf->computeChainDataLength();
+      int32_t header[2] = {compressedSize, rawSize};
+      auto& file = currentOutput();
+      file.append(std::string_view(
+          reinterpret_cast<const char*>(header), sizeof(header)));
+      for (auto& range : *iobuf) {
+        file.append(std::string_view(
+            reinterpret_cast<const char*>(range.data()), range.size()));
+      }
+      return;
+    }
     auto& file = currentOutput();
     for (auto& range : *iobuf) {
       file.append(std::string_view(
@@ -174,7 +231,8 @@ void SpillState::appendToPartition(
         fmt::format("{}-spill-{}", path_, partition),
         targetFileSize_,
         pool_,
-        mappedMemory_);
+        mappedMemory_,
+        compressionCodec_);
   }
 
   IndexRange range{0, rows->size()};
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/compression/Compression.h>
+
 #include "velox/common/file/File.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/TreeOfLosers.h"
@@ -62,13 +64,15 @@ class SpillFile {
       int32_t numSortingKeys,
       const std::vector<CompareFlags>& sortCompareFlags,
       const std::string& path,
-      memory::MemoryPool& pool)
+      memory::MemoryPool& pool,
+      const std::string& compressionCodec = "none")
       : type_(std::move(type)),
         numSortingKeys_(numSortingKeys),
         sortCompareFlags_(sortCompareFlags),
         pool_(pool),
         ordinal_(ordinalCounter_++),
-        path_(fmt::format("{}-{}", path, ordinal_)) {
+        path_(fmt::format("{}-{}", path, ordinal_)),
+        compressionCodec_(compressionCodec) {
     // NOTE: if the spilling operator has specified the sort comparison flags,
     // then it must match the number of sorting keys.
     VELOX_CHECK(
@@ -141,6 +145,16 @@ class SpillFile {
   const int32_t ordinal_;
   const std::string path_;
 
+  // Codec name, "none" for uncompressed.
+  const std::string compressionCodec_;
+
+  // Codec decompressing read batches, created at startRead(), nullptr
+  // when uncompressed.
+  std::unique_ptr<folly::io::Codec> codec_;
+
+  // Scratch holding one compressed batch during read.
+  std::string compressedScratch_;
+
   // Byte size of the backing file. Set when finishing writing.
   uint64_t fileSize_ = 0;
   std::unique_ptr<WriteFile> output_;
@@ -170,14 +184,16 @@ class SpillFileList {
       const std::string& path,
       uint64_t targetFileSize,
       memory::MemoryPool& pool,
-      memory::MappedMemory& mappedMemory)
+      memory::MappedMemory& mappedMemory,
+      const std::string& compressionCodec = "none")
       : type_(type),
         numSortingKeys_(numSortingKeys),
         sortCompareFlags_(sortCompareFlags),
         path_(path),
         targetFileSize_(targetFileSize),
         pool_(pool),
-        mappedMemory_(mappedMemory) {
+        mappedMemory_(mappedMemory),
+        compressionCodec_(compressionCodec) {
     // NOTE: if the associated spilling operator has specified the sort
     // comparison flags, then it must match the number of sorting keys.
     VELOX_CHECK(
@@ -224,6 +240,15 @@ class SpillFileList {
   const uint64_t targetFileSize_;
   memory::MemoryPool& pool_;
   memory::MappedMemory& mappedMemory_;
+
+  // Codec name, "none" for uncompressed.
+  const std::string compressionCodec_;
+
+  // Codec compressing flushed batches, created on first flush, nullptr
+  // when uncompressed.
+  std::unique_ptr<folly::io::Codec> codec_;
+  bool codecCreated_{false};
+
   std::unique_ptr<VectorStreamGroup> batch_;
   SpillFiles files_;
 };
@@ -552,7 +577,8 @@ class SpillState {
       const std::vector<CompareFlags>& sortCompareFlags,
       uint64_t targetFileSize,
       memory::MemoryPool& pool,
-      memory::MappedMemory& mappedMemory)
+      memory::MappedMemory& mappedMemory,
+      const std::string& compressionCodec = "none")
       : path_(path),
         maxPartitions_(maxPartitions),
         numSortingKeys_(numSortingKeys),
@@ -560,6 +586,7 @@ class SpillState {
         targetFileSize_(targetFileSize),
         pool_(pool),
         mappedMemory_(mappedMemory),
+        compressionCodec_(compressionCodec),
         files_(maxPartitions_) {}
 
   /// Indicates if a given 'partition' has been spilled or not.
@@ -646,6 +673,9 @@ class SpillState {
   memory::MemoryPool& pool_;
   memory::MappedMemory& mappedMemory_;
 
+  // Codec name for spill files, "none" for uncompressed.
+  const std::string compressionCodec_;
+
   // A set of spilled partition numbers.
   SpillPartitionNumSet spilledPartitionSet_;
 
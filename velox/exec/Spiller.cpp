@@ -17,6 +17,7 @@
 #include "velox/exec/Spiller.h"
 
 #include "velox/common/base/AsyncSource.h"
+#include "velox/exec/Driver.h"
 
 #include <folly/ScopeGuard.h>
 #include "velox/common/testutil/TestValue.h"
@@ -37,7 +38,8 @@ Spiller::Spiller(
     const std::string& path,
     int64_t targetFileSize,
     memory::MemoryPool& pool,
-    folly::Executor* executor)
+    folly::Executor* executor,
+    const std::string& compressionCodec)
     : Spiller(
           type,
           container,
@@ -49,7 +51,8 @@ Spiller::Spiller(
           path,
           targetFileSize,
           pool,
-          executor) {
+          executor,
+          compressionCodec) {
   VELOX_CHECK_EQ(type_, Type::kOrderBy);
 }
 
@@ -60,7 +63,8 @@ Spiller::Spiller(
     const std::string& path,
     int64_t targetFileSize,
     memory::MemoryPool& pool,
-    folly::Executor* FOLLY_NULLABLE executor)
+    folly::Executor* FOLLY_NULLABLE executor,
+    const std::string& compressionCodec)
     : Spiller(
           type,
           nullptr,
@@ -72,7 +76,8 @@ Spiller::Spiller(
           path,
           targetFileSize,
           pool,
-          executor) {
+          executor,
+          compressionCodec) {
   VELOX_CHECK_EQ(type_, Type::kHashJoinProbe);
 }
 
@@ -87,7 +92,8 @@ Spiller::Spiller(
     const std::string& path,
     int64_t targetFileSize,
     memory::MemoryPool& pool,
-    folly::Executor* executor)
+    folly::Executor* executor,
+    const std::string& compressionCodec)
     : type_(type),
       container_(container),
       eraser_(eraser),
@@ -100,7 +106,8 @@ Spiller::Spiller(
           sortCompareFlags,
           targetFileSize,
           pool,
-          spillMappedMemory()),
+          spillMappedMemory(),
+          compressionCodec),
       pool_(pool),
       executor_(executor) {
   TestValue::adjust(
@@ -239,10 +246,14 @@ std::unique_ptr<SpillMergeStream> Spiller::spillMergeStreamOverRows(
 void Spiller::ensureSorted(SpillRun& run) {
   // The spill data of a hash join doesn't need to be sorted.
   if (!run.sorted && needSort()) {
+    size_t cancelCheckCounter = 0;
     std::sort(
         run.rows.begin(),
         run.rows.end(),
         [&](const char* left, const char* right) {
+          if (FOLLY_UNLIKELY((++cancelCheckCounter & 0xffff) == 0)) {
+            checkRunningDriverCancelled();
+          }
           return container_->compareRows(
                      left, right, state_.sortCompareFlags()) < 0;
         });
@@ -266,6 +277,7 @@ std::unique_ptr<Spiller::SpillStatus> Spiller::writeSpill(int32_t partition) {
     int64_t totalBytes = 0;
     size_t written = 0;
     while (written < run.rows.size()) {
+      checkRunningDriverCancelled();
       totalBytes += extractSpillVector(
           run.rows, kTargetBatchRows, kTargetBatchBytes, spillVector, written);
       state_.appendToPartition(partition, spillVector);
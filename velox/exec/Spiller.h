@@ -45,13 +45,15 @@ class Spiller {
         folly::Executor* FOLLY_NULLABLE _executor,
         int32_t _spillableReservationGrowthPct,
         const HashBitRange& _hashBitRange,
-        int32_t _testSpillPct)
+        int32_t _testSpillPct,
+        const std::string& _compressionCodec = "none")
         : filePath(_filePath),
           fileSizeFactor(_fileSizeFactor),
           executor(_executor),
           spillableReservationGrowthPct(_spillableReservationGrowthPct),
           hashBitRange(_hashBitRange),
-          testSpillPct(_testSpillPct) {}
+          testSpillPct(_testSpillPct),
+          compressionCodec(_compressionCodec) {}
 
     // Filesystem path for spill files.
     std::string filePath;
@@ -73,6 +75,10 @@ class Spiller {
     // Percentage of input batches to be spilled for testing. 0 means no
     // spilling for test.
     int32_t testSpillPct;
+
+    // Codec for compressing spill files: "none", "zstd", "lz4" or
+    // "snappy".
+    std::string compressionCodec;
   };
 
   using SpillRows = std::vector<char*, memory::StlMappedMemoryAllocator<char*>>;
@@ -89,7 +95,8 @@ class Spiller {
       const std::string& path,
       int64_t targetFileSize,
       memory::MemoryPool& pool,
-      folly::Executor* FOLLY_NULLABLE executor);
+      folly::Executor* FOLLY_NULLABLE executor,
+      const std::string& compressionCodec = "none");
 
   Spiller(
       Type type,
@@ -98,7 +105,8 @@ class Spiller {
       const std::string& path,
       int64_t targetFileSize,
       memory::MemoryPool& pool,
-      folly::Executor* FOLLY_NULLABLE executor);
+      folly::Executor* FOLLY_NULLABLE executor,
+      const std::string& compressionCodec = "none");
 
   Spiller(
       Type type,
@@ -111,7 +119,8 @@ class Spiller {
       const std::string& path,
       int64_t targetFileSize,
       memory::MemoryPool& pool,
-      folly::Executor* FOLLY_NULLABLE executor);
+      folly::Executor* FOLLY_NULLABLE executor,
+      const std::string& compressionCodec = "none");
 
   /// Spills rows from 'this' until there are under 'targetRows' rows
   /// and 'targetBytes' of allocated variable length space in use. spill()
@@ -106,7 +106,17 @@ RowVectorPtr TableScan::getOutput() {
          },
          &debugString_});
 
-    auto dataOptional = dataSource_->next(readBatchSize_, blockingFuture_);
+    int64_t batchSize = readBatchSize_;
+    if (driverCtx_->rowBudget < batchSize) {
+      // A downstream Limit consumes at most 'rowBudget' more rows. The
+      // Limit publishes a budget only when everything between this scan
+      // and it is a filter or projection, so clamping never starves an
+      // accumulating operator; filters may still drop rows, in which
+      // case the scan is simply polled again with the then-current
+      // budget.
+      batchSize = std::max<int64_t>(1, driverCtx_->rowBudget);
+    }
+    auto dataOptional = dataSource_->next(batchSize, blockingFuture_);
     if (!dataOptional.has_value()) {
       blockingReason_ = BlockingReason::kWaitForConnector;
       return nullptr;
@@ -338,14 +338,22 @@ void Task::start(
   const auto& config = self->queryCtx()->config();
   if (config.codegenEnabled() &&
       config.codegenConfigurationFilePath().length() != 0) {
-    auto codegenLogger =
-        std::make_shared<codegen::DefaultLogger>(self->taskId_);
-    auto codegen = codegen::Codegen(codegenLogger);
-    auto lazyLoading = config.codegenLazyLoading();
-    codegen.initializeFromFile(
-        config.codegenConfigurationFilePath(), lazyLoading);
-    if (auto newPlanNode = codegen.compile(*(self->planFragment_.planNode))) {
-      self->planFragment_.planNode = newPlanNode;
+    // Codegen is best effort: any failure to initialize, compile or
+    // load the generated code leaves the interpreted plan in place.
+    try {
+      auto codegenLogger =
+          std::make_shared<codegen::DefaultLogger>(self->taskId_);
+      auto codegen = codegen::Codegen(codegenLogger);
+      auto lazyLoading = config.codegenLazyLoading();
+      codegen.initializeFromFile(
+          config.codegenConfigurationFilePath(), lazyLoading);
+      if (auto newPlanNode =
+              codegen.compile(*(self->planFragment_.planNode))) {
+        self->planFragment_.planNode = newPlanNode;
+      }
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Codegen failed for task " << self->taskId_
+                   << ", falling back to the interpreted plan: " << e.what();
     }
   }
 #endif
@@ -1450,6 +1458,34 @@ ContinueFuture Task::stateChangeFuture(uint64_t maxWaitMicros) {
   return std::move(future);
 }
 
+void Task::addTraceEvents(std::vector<Driver::TraceEvent>&& events) {
+  std::lock_guard<std::mutex> l(mutex_);
+  traceEvents_.insert(
+      traceEvents_.end(),
+      std::make_move_iterator(events.begin()),
+      std::make_move_iterator(events.end()));
+}
+
+std::string Task::traceEventsJson() const {
+  std::stringstream out;
+  out << "{\"traceEvents\":[";
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    for (auto i = 0; i < traceEvents_.size(); ++i) {
+      const auto& event = traceEvents_[i];
+      if (i > 0) {
+        out << ",";
+      }
+      out << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"ts\":"
+          << event.startUs << ",\"dur\":" << event.durationUs
+          << ",\"pid\":" << event.pipelineId << ",\"tid\":" << event.driverId
+          << "}";
+    }
+  }
+  out << "]}";
+  return out.str();
+}
+
 std::string Task::toString() const {
   std::stringstream out;
   out << "{Task " << shortId(taskId_) << " (" << taskId_ << ")";
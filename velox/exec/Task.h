@@ -69,6 +69,15 @@ class Task : public std::enable_shared_from_this<Task> {
 
   std::string toString() const;
 
+  /// Appends a finished driver's trace events; called from
+  /// Driver::close when query tracing is enabled.
+  void addTraceEvents(std::vector<Driver::TraceEvent>&& events);
+
+  /// Returns all recorded operator call spans and blocked intervals as
+  /// Chrome trace-event JSON ("chrome://tracing" / Perfetto format).
+  /// Empty when query_trace_enabled is not set.
+  std::string traceEventsJson() const;
+
   /// Returns universally unique identifier of the task.
   const std::string& uuid() const {
     return uuid_;
@@ -469,6 +478,13 @@ class Task : public std::enable_shared_from_this<Task> {
     return terminate(kAborted);
   }
 
+  /// Flag polled by long-running kernels through
+  /// checkRunningDriverCancelled() so that terminate does not wait out
+  /// the batch in flight.
+  const std::atomic<bool>& terminateRequestedFlag() const {
+    return terminateRequested_;
+  }
+
   void requestYield() {
     std::lock_guard<std::mutex> l(mutex_);
     toYield_ = numThreads_;
@@ -819,6 +835,9 @@ class Task : public std::enable_shared_from_this<Task> {
 
   TaskStats taskStats_;
 
+  // Trace events handed over by finished drivers, see addTraceEvents.
+  std::vector<Driver::TraceEvent> traceEvents_;
+
   /// Stores inter-operator state (exchange, bridges) per split group.
   /// During ungrouped execution we use the [0] entry in this vector.
   std::unordered_map<uint32_t, SplitGroupState> splitGroupStates_;
@@ -15,6 +15,7 @@
  */
 #include "velox/exec/TopN.h"
 #include "velox/exec/ContainerRowSerde.h"
+#include "velox/exec/OperatorUtils.h"
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
@@ -38,7 +39,49 @@ TopN::TopN(
           topNNode->sortingOrders(),
           data_.get()),
       topRows_(comparator_),
-      decodedVectors_(outputType_->children().size()) {}
+      decodedVectors_(outputType_->children().size()) {
+  firstKeyChannel_ =
+      exprToChannel(topNNode->sortingKeys()[0].get(), outputType_);
+  firstKeyType_ = outputType_->childAt(firstKeyChannel_)->kind();
+  firstKeyOrder_ = topNNode->sortingOrders()[0];
+  char zeros[16] = {};
+  uint64_t probe;
+  prefixSupported_ = encodeSortKeyPrefix(firstKeyType_, zeros, probe);
+}
+
+bool TopN::rejectedByThreshold(vector_size_t row) {
+  if (thresholdDirty_) {
+    updateThreshold();
+  }
+  const auto& decoded = decodedVectors_[firstKeyChannel_];
+  uint64_t prefix;
+  if (decoded.isNullAt(row)) {
+    prefix = firstKeyOrder_.isNullsFirst() ? 0 : ~0ULL;
+  } else {
+    encodeSortKeyPrefix(firstKeyType_, decoded, row, prefix);
+    if (!firstKeyOrder_.isAscending()) {
+      prefix = ~prefix;
+    }
+  }
+  // Reject when the heap top provably sorts before the row; equal
+  // prefixes go through the full comparator.
+  return thresholdPrefix_ < prefix;
+}
+
+void TopN::updateThreshold() {
+  const char* top = topRows_.top();
+  const auto column = data_->columnAt(firstKeyChannel_);
+  if (top[column.nullByte()] & column.nullMask()) {
+    thresholdPrefix_ = firstKeyOrder_.isNullsFirst() ? 0 : ~0ULL;
+  } else {
+    encodeSortKeyPrefix(
+        firstKeyType_, top + column.offset(), thresholdPrefix_);
+    if (!firstKeyOrder_.isAscending()) {
+      thresholdPrefix_ = ~thresholdPrefix_;
+    }
+  }
+  thresholdDirty_ = false;
+}
 
 TopN::Comparator::Comparator(
     const RowTypePtr& type,
@@ -70,6 +113,9 @@ void TopN::addInput(RowVectorPtr input) {
     if (topRows_.size() < count_) {
       newRow = data_->newRow();
     } else {
+      if (prefixSupported_ && rejectedByThreshold(row)) {
+        continue;
+      }
       char* topRow = topRows_.top();
 
       if (comparator_(topRow, decodedVectors_, row)) {
@@ -85,6 +131,7 @@ void TopN::addInput(RowVectorPtr input) {
     }
 
     topRows_.push(newRow);
+    thresholdDirty_ = true;
   }
 }
 
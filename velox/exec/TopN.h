@@ -96,9 +96,31 @@ class TopN : public Operator {
 
   const int32_t count_;
 
+  // Returns true if 'row' of the decoded first sort key provably sorts
+  // at or after the current top of the heap, using the cached
+  // normalized prefix of the top row's key. One branch rejects most
+  // rows of a full heap without a comparator call.
+  bool rejectedByThreshold(vector_size_t row);
+
+  // Recomputes 'thresholdPrefix_' from the heap top's first key.
+  void updateThreshold();
+
   bool finished_ = false;
   uint32_t numRowsReturned_ = 0;
 
+  // True if the first sort key's type has a normalized prefix encoding.
+  bool prefixSupported_{false};
+
+  // First sort key description for the threshold fast path.
+  column_index_t firstKeyChannel_{0};
+  TypeKind firstKeyType_{TypeKind::BIGINT};
+  core::SortOrder firstKeyOrder_{true, true};
+
+  // Normalized prefix of the heap top's first key, valid when the heap
+  // is full and not 'thresholdDirty_'.
+  uint64_t thresholdPrefix_{0};
+  bool thresholdDirty_{true};
+
   // As the inputs are added to TopN operator, we use topRows_ (a priority
   // queue) to keep track of the pointers to rows stored in the
   // RowContainer (data_). We only update the RowContainer if a row is a
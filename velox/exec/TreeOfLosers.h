@@ -106,6 +106,7 @@ class TreeOfLosers {
   // expected to pop off the first element of the stream before
   // calling this again. Returns nullptr when all streams are at end.
   Stream* next() {
+    runnerUpValid_ = false;
     if (UNLIKELY(lastIndex_ == kEmpty)) {
       if (UNLIKELY(values_.empty())) {
         // Only one stream. We handle this off the common path.
@@ -120,6 +121,42 @@ class TreeOfLosers {
     return lastIndex_ == kEmpty ? nullptr : streams_[lastIndex_].get();
   }
 
+  /// True if the stream last returned by next(), after the caller
+  /// popped some of its values, still sorts before every other
+  /// stream's current value, so the caller may keep consuming it
+  /// without updating the tree. The runner-up is the minimum over the
+  /// losers on the winner's root path, all other streams lost to one
+  /// of them, and cannot change while only the winner is consumed; it
+  /// is computed once per tree update and then each run row costs one
+  /// comparison. Valid after next() returned non-null and while that
+  /// stream has data.
+  bool lastStreamStillFirst() {
+    if (values_.empty()) {
+      // Single stream.
+      return true;
+    }
+    if (lastIndex_ == kEmpty) {
+      return false;
+    }
+    ensureRunnerUp();
+    if (runnerUp_ == kEmpty) {
+      return true;
+    }
+    return *streams_[lastIndex_] < *streams_[runnerUp_];
+  }
+
+  /// Returns the stream with the smallest current value among all
+  /// streams other than the one last returned by next(), or nullptr
+  /// if no other stream has data. Valid under the same conditions as
+  /// lastStreamStillFirst().
+  Stream* runnerUpStream() {
+    if (values_.empty() || lastIndex_ == kEmpty) {
+      return nullptr;
+    }
+    ensureRunnerUp();
+    return runnerUp_ == kEmpty ? nullptr : streams_[runnerUp_].get();
+  }
+
   // Returns the stream with the lowest first element and a flag that
   // is true if there is another equal value to come from some other
   // stream. The streams should have ordered unique values when using
@@ -128,6 +165,7 @@ class TreeOfLosers {
   // expected to pop off the first element of the stream before
   // calling this again. Returns {nullptr, false} when all streams are at end.
   std::pair<Stream*, bool> nextWithEquals() {
+    runnerUpValid_ = false;
     IndexAndFlag result;
     if (UNLIKELY(lastIndex_ == kEmpty)) {
       // Only one stream. We handle this off the common path.
@@ -151,6 +189,31 @@ class TreeOfLosers {
  private:
   static constexpr TIndex kEmpty = std::numeric_limits<TIndex>::max();
 
+  // Cached runner-up for lastStreamStillFirst(), invalidated by every
+  // tree update.
+  TIndex runnerUp_{std::numeric_limits<TIndex>::max()};
+  bool runnerUpValid_{false};
+
+  // Computes 'runnerUp_' as the minimum over the losers on the
+  // winner's root path if not cached.
+  void ensureRunnerUp() {
+    if (runnerUpValid_) {
+      return;
+    }
+    runnerUp_ = kEmpty;
+    for (auto node = parent(firstStream_ + lastIndex_);; node = parent(node)) {
+      const auto loser = values_[node];
+      if (loser != kEmpty &&
+          (runnerUp_ == kEmpty || *streams_[loser] < *streams_[runnerUp_])) {
+        runnerUp_ = loser;
+      }
+      if (node == 0) {
+        break;
+      }
+    }
+    runnerUpValid_ = true;
+  }
+
   IndexAndFlag indexAndFlag(TIndex index, bool flag) {
     return std::pair<TIndex, bool>{index, flag};
   }
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/VectorHashMemo.h"
+
+namespace facebook::velox::exec {
+
+raw_vector<uint64_t>& VectorHashMemo::hashes(
+    const BaseVector* base,
+    const VectorPtr& owner) {
+  ++clock_;
+  for (auto& entry : entries_) {
+    if (entry.base == base) {
+      entry.lastUse = clock_;
+      if (entry.hashes.size() < base->size()) {
+        auto oldSize = entry.hashes.size();
+        entry.hashes.resize(base->size());
+        std::fill(
+            entry.hashes.begin() + oldSize,
+            entry.hashes.end(),
+            BaseVector::kNullHash);
+      }
+      return entry.hashes;
+    }
+  }
+  if (entries_.size() >= kMaxEntries) {
+    auto oldest = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->lastUse < oldest->lastUse) {
+        oldest = it;
+      }
+    }
+    // Swap with the last entry instead of erasing in place:
+    // raw_vector's move assignment does not free the target's
+    // allocation, so move-assigning over a live entry would leak it.
+    std::swap(*oldest, entries_.back());
+    entries_.pop_back();
+  }
+  auto& entry = entries_.emplace_back();
+  entry.base = base;
+  entry.owner = owner;
+  entry.hashes.resize(base->size());
+  std::fill(entry.hashes.begin(), entry.hashes.end(), BaseVector::kNullHash);
+  entry.lastUse = clock_;
+  return entry.hashes;
+}
+
+} // namespace facebook::velox::exec
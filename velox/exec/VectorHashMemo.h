@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/common/base/RawVector.h"
+#include "velox/vector/BaseVector.h"
+
+namespace facebook::velox::exec {
+
+/// Memo of per-value hashes of key columns, shared by the VectorHashers
+/// of one Driver's operators. Lets chained hash probes and a downstream
+/// group by over the same key column reuse the hashes of the decoded
+/// base values computed by the first hasher instead of re-hashing the
+/// column in every operator. This pays off most for dictionary-encoded
+/// keys, where the base is the dictionary alphabet shared across
+/// batches. An entry is keyed by the address of the decoded base and
+/// holds a reference to the vector it was decoded through, so the base
+/// stays alive and its address cannot be recycled while the entry
+/// exists. Not thread safe, use from the Driver thread only.
+class VectorHashMemo {
+ public:
+  /// Returns the hash cache for 'base', creating an entry filled with
+  /// BaseVector::kNullHash on first use and extending it with
+  /// kNullHash if 'base' has grown. 'owner' is the vector 'base' was
+  /// decoded from and keeps it alive. The least recently used entry is
+  /// evicted when more than kMaxEntries bases are tracked.
+  raw_vector<uint64_t>& hashes(
+      const BaseVector* FOLLY_NONNULL base,
+      const VectorPtr& owner);
+
+ private:
+  static constexpr int32_t kMaxEntries = 8;
+
+  struct Entry {
+    const BaseVector* base;
+    VectorPtr owner;
+    raw_vector<uint64_t> hashes;
+    uint64_t lastUse;
+  };
+
+  std::vector<Entry> entries_;
+
+  // Incremented on each lookup, stamps entries for LRU eviction.
+  uint64_t clock_{0};
+};
+
+} // namespace facebook::velox::exec
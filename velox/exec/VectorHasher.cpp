@@ -83,28 +83,43 @@ void VectorHasher::hashValues(
     rows.applyToSelected([&](vector_size_t row) {
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
     });
-  } else if (decoded_.isIdentityMapping()) {
-    rows.applyToSelected([&](vector_size_t row) {
-      if (decoded_.isNullAt(row)) {
-        result[row] = mix ? bits::hashMix(result[row], kNullHash) : kNullHash;
-        return;
-      }
-      auto hash = hashOne<Kind>(decoded_, row);
-      result[row] = mix ? bits::hashMix(result[row], hash) : hash;
-    });
   } else {
-    cachedHashes_.resize(decoded_.base()->size());
-    std::fill(cachedHashes_.begin(), cachedHashes_.end(), kNullHash);
+    if (decoded_.isIdentityMapping()) {
+      // Flat bases are seen once; hash straight into the result with no
+      // memo lookup or cache fill.
+      rows.applyToSelected([&](vector_size_t row) {
+        if (decoded_.isNullAt(row)) {
+          result[row] = mix ? bits::hashMix(result[row], kNullHash) : kNullHash;
+          return;
+        }
+        auto hash = hashOne<Kind>(decoded_, row);
+        result[row] = mix ? bits::hashMix(result[row], hash) : hash;
+      });
+      return;
+    }
+    // Hashes of a dictionary base memoized across calls and hashers, or
+    // nullptr if not shared. Only non-identity mappings profit: a base
+    // referenced by several batches or keys hashes each distinct value
+    // once.
+    raw_vector<uint64_t>* memoized = memo_ != nullptr && memoOwner_ != nullptr
+        ? &memo_->hashes(decoded_.base(), memoOwner_)
+        : nullptr;
+    auto* cached = memoized;
+    if (cached == nullptr) {
+      cachedHashes_.resize(decoded_.base()->size());
+      std::fill(cachedHashes_.begin(), cachedHashes_.end(), kNullHash);
+      cached = &cachedHashes_;
+    }
     rows.applyToSelected([&](vector_size_t row) {
       if (decoded_.isNullAt(row)) {
         result[row] = mix ? bits::hashMix(result[row], kNullHash) : kNullHash;
         return;
       }
       auto baseIndex = decoded_.index(row);
-      uint64_t hash = cachedHashes_[baseIndex];
+      uint64_t hash = (*cached)[baseIndex];
       if (hash == kNullHash) {
         hash = hashOne<Kind>(decoded_, row);
-        cachedHashes_[baseIndex] = hash;
+        (*cached)[baseIndex] = hash;
       }
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
     });
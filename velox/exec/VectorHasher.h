@@ -20,6 +20,7 @@
 #include <velox/type/Filter.h>
 #include "velox/common/base/RawVector.h"
 #include "velox/exec/Operator.h"
+#include "velox/exec/VectorHashMemo.h"
 #include "velox/vector/FlatVector.h"
 #include "velox/vector/VectorTypeUtils.h"
 
@@ -179,9 +180,25 @@ class VectorHasher {
   // computeValueIds(). The decoded vector can be accessed via decodedVector()
   // getter.
   void decode(const BaseVector& vector, const SelectivityVector& rows) {
+    memoOwner_.reset();
     decoded_.decode(vector, rows);
   }
 
+  // Same as above but loads 'vector' if lazy and remembers it as the
+  // owner of the decoded base, so that hashes of the base values can be
+  // shared with other hashers via setHashMemo().
+  void decode(const VectorPtr& vector, const SelectivityVector& rows) {
+    memoOwner_ = vector;
+    decoded_.decode(*vector->loadedVector(), rows);
+  }
+
+  // Sets a memo of per-value hashes shared with the other hashers of
+  // the same Driver. Hashes are memoized only for vectors decoded via
+  // the owner-aware decode() overload. 'memo' must outlive 'this'.
+  void setHashMemo(VectorHashMemo* FOLLY_NULLABLE memo) {
+    memo_ = memo;
+  }
+
   DecodedVector& decodedVector() {
     return decoded_;
   }
@@ -546,6 +563,15 @@ class VectorHasher {
   DecodedVector decoded_;
   raw_vector<uint64_t> cachedHashes_;
 
+  // Memo of base value hashes shared across the Driver's hashers,
+  // nullptr if hashes are not shared.
+  VectorHashMemo* FOLLY_NULLABLE memo_{nullptr};
+
+  // Vector the current decoded base belongs to. Pins the base in
+  // 'memo_'. nullptr if decoded without an owner, in which case hashes
+  // are not memoized.
+  VectorPtr memoOwner_;
+
   // Single precomputed hash for constant partition keys.
   uint64_t precomputedHash_{0};
 
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/WorkStealingExecutor.h"
+
+#include <folly/system/ThreadName.h>
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::exec {
+
+namespace {
+// Index of the worker owned by the current thread in its
+// WorkStealingExecutor, or -1 if the thread is not a worker. Used to
+// route add() from a worker to the worker's own deque.
+thread_local WorkStealingExecutor* currentExecutor{nullptr};
+thread_local int32_t currentWorkerIndex{-1};
+} // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(
+    int32_t numThreads,
+    const std::string& threadNamePrefix) {
+  VELOX_CHECK_GT(numThreads, 0);
+  workers_.reserve(numThreads);
+  for (auto i = 0; i < numThreads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(numThreads);
+  for (auto i = 0; i < numThreads; ++i) {
+    threads_.emplace_back([this, i, threadNamePrefix]() {
+      folly::setThreadName(fmt::format("{}.{}", threadNamePrefix, i));
+      workerLoop(i);
+    });
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  join();
+}
+
+void WorkStealingExecutor::add(folly::Func func) {
+  VELOX_CHECK(!stopped_, "add() on joined WorkStealingExecutor");
+  int32_t index;
+  if (currentExecutor == this) {
+    // Enqueued from a worker thread: stay local so the continuation runs
+    // with a warm cache unless somebody steals it.
+    index = currentWorkerIndex;
+  } else {
+    index = nextQueue_++ % workers_.size();
+  }
+  {
+    std::lock_guard<std::mutex> l(workers_[index]->mutex);
+    workers_[index]->queue.push_back(std::move(func));
+  }
+  ++numQueued_;
+  {
+    // Take the mutex unconditionally: checking 'numSleeping_' outside of it
+    // could miss a worker that is between its empty-queue check and wait().
+    std::lock_guard<std::mutex> l(sleepMutex_);
+    if (numSleeping_ > 0) {
+      wakeup_.notify_one();
+    }
+  }
+}
+
+folly::Func WorkStealingExecutor::popLocal(int32_t index) {
+  auto& worker = *workers_[index];
+  std::lock_guard<std::mutex> l(worker.mutex);
+  if (worker.queue.empty()) {
+    return nullptr;
+  }
+  // Newest first: the most recently enqueued Driver has the hottest state.
+  auto func = std::move(worker.queue.back());
+  worker.queue.pop_back();
+  return func;
+}
+
+folly::Func WorkStealingExecutor::steal(int32_t index) {
+  const auto numWorkers = static_cast<int32_t>(workers_.size());
+  for (auto i = 1; i < numWorkers; ++i) {
+    auto& victim = *workers_[(index + i) % numWorkers];
+    std::lock_guard<std::mutex> l(victim.mutex);
+    if (!victim.queue.empty()) {
+      // Oldest first: the item least likely to be cached on the victim
+      // and the one that has waited longest.
+      auto func = std::move(victim.queue.front());
+      victim.queue.pop_front();
+      return func;
+    }
+  }
+  return nullptr;
+}
+
+void WorkStealingExecutor::workerLoop(int32_t index) {
+  currentExecutor = this;
+  currentWorkerIndex = index;
+  for (;;) {
+    auto func = popLocal(index);
+    if (!func) {
+      func = steal(index);
+    }
+    if (func) {
+      --numQueued_;
+      func();
+      // Release the closure before looking for more work so captured
+      // Driver shared_ptrs do not outlive the run.
+      func = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> l(sleepMutex_);
+    if (numQueued_ > 0) {
+      // Work arrived between the failed steal and taking the lock. Drain
+      // it even if stopping: join() waits for queued work to finish.
+      continue;
+    }
+    if (stopped_) {
+      return;
+    }
+    ++numSleeping_;
+    wakeup_.wait(l, [&]() { return stopped_ || numQueued_ > 0; });
+    --numSleeping_;
+    if (stopped_ && numQueued_ == 0) {
+      return;
+    }
+  }
+}
+
+size_t WorkStealingExecutor::queuedCount() const {
+  auto count = numQueued_.load();
+  return count < 0 ? 0 : static_cast<size_t>(count);
+}
+
+void WorkStealingExecutor::join() {
+  if (threads_.empty()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> l(sleepMutex_);
+    stopped_ = true;
+    wakeup_.notify_all();
+  }
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+  threads_.clear();
+}
+
+} // namespace facebook::velox::exec
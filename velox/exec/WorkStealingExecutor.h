@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Executor.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook::velox::exec {
+
+/// Executor for running Drivers with per-thread work queues and work
+/// stealing. Each worker thread owns a deque of ready work items. A
+/// worker that runs out of local work steals the oldest item from a
+/// peer's deque. Work added from a worker thread goes to that worker's
+/// own deque, so Drivers that unblock each other (e.g. producer/consumer
+/// pairs of a local exchange) tend to stay on the same core, while
+/// stealing keeps all threads busy when one Task's pipelines stall.
+///
+/// This can be used as the Task executor in place of a
+/// folly::CPUThreadPoolExecutor. Driver::enqueue goes through
+/// folly::Executor::add and needs no special casing.
+class WorkStealingExecutor : public folly::Executor {
+ public:
+  explicit WorkStealingExecutor(
+      int32_t numThreads,
+      const std::string& threadNamePrefix = "velox.driver");
+
+  ~WorkStealingExecutor() override;
+
+  void add(folly::Func func) override;
+
+  int32_t numThreads() const {
+    return workers_.size();
+  }
+
+  /// Returns the number of queued work items over all workers. Approximate:
+  /// the queues are read without a global lock. Test and monitoring use only.
+  size_t queuedCount() const;
+
+  /// Waits until all queued and running work has completed and stops the
+  /// worker threads. Called by the destructor.
+  void join();
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<folly::Func> queue;
+  };
+
+  // Runs the worker loop for 'workers_[index]': drain the local deque,
+  // then try stealing, then sleep on 'wakeup_'.
+  void workerLoop(int32_t index);
+
+  // Pops the newest item from the local deque of 'workers_[index]', if any.
+  folly::Func popLocal(int32_t index);
+
+  // Steals the oldest item from some other worker's deque, if any.
+  folly::Func steal(int32_t index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  // Protects 'numSleeping_' and pairs with 'wakeup_'.
+  std::mutex sleepMutex_;
+  std::condition_variable wakeup_;
+  int32_t numSleeping_{0};
+
+  // Round robin counter for choosing the target queue when adding work
+  // from a non-worker thread.
+  std::atomic<uint32_t> nextQueue_{0};
+
+  std::atomic<bool> stopped_{false};
+  std::atomic<int64_t> numQueued_{0};
+};
+
+} // namespace facebook::velox::exec
@@ -461,6 +461,65 @@ TEST_F(AggregationTest, multiKeyDistinct) {
   testMultiKey(vectors, true, true);
 }
 
+TEST_F(AggregationTest, adaptiveOutputBatchRows) {
+  auto vectors = makeVectors(rowType_, 10, 100);
+  createDuckDbTable(vectors);
+
+  const std::string sql = "SELECT c0, sum(c1) FROM tmp GROUP BY c0";
+  auto makePlan = [&](core::PlanNodeId& aggNodeId) {
+    return PlanBuilder()
+        .values(vectors)
+        .singleAggregation({"c0"}, {"sum(c1)"})
+        .capturePlanNodeId(aggNodeId)
+        .planNode();
+  };
+
+  // With a tiny byte budget, output comes in many small batches; with
+  // the default budget it comes in few large ones.
+  core::PlanNodeId smallBudgetNodeId;
+  auto smallBudgetTask = AssertQueryBuilder(duckDbQueryRunner_)
+                             .config(QueryConfig::kPreferredOutputBatchBytes, "1")
+                             .plan(makePlan(smallBudgetNodeId))
+                             .assertResults(sql);
+
+  core::PlanNodeId defaultNodeId;
+  auto defaultTask = AssertQueryBuilder(duckDbQueryRunner_)
+                         .plan(makePlan(defaultNodeId))
+                         .assertResults(sql);
+
+  EXPECT_GT(
+      toPlanStats(smallBudgetTask->taskStats())
+          .at(smallBudgetNodeId)
+          .outputVectors,
+      toPlanStats(defaultTask->taskStats()).at(defaultNodeId).outputVectors);
+}
+
+TEST_F(AggregationTest, columnarAccumulators) {
+  auto vectors = makeVectors(rowType_, 10, 100);
+  createDuckDbTable(vectors);
+
+  // All accumulators fixed-width: the columnar layout applies.
+  AssertQueryBuilder(duckDbQueryRunner_)
+      .config(QueryConfig::kColumnarAccumulatorsEnabled, "true")
+      .plan(PlanBuilder()
+                .values(vectors)
+                .singleAggregation(
+                    {"c0"}, {"sum(c1)", "count(c2)", "min(c3)", "max(c4)"})
+                .planNode())
+      .assertResults(
+          "SELECT c0, sum(c1), count(c2), min(c3), max(c4) FROM tmp GROUP BY c0");
+
+  // A variable-width accumulator (min on strings) falls back to the
+  // row-wise layout.
+  AssertQueryBuilder(duckDbQueryRunner_)
+      .config(QueryConfig::kColumnarAccumulatorsEnabled, "true")
+      .plan(PlanBuilder()
+                .values(vectors)
+                .singleAggregation({"c0"}, {"sum(c1)", "min(c6)"})
+                .planNode())
+      .assertResults("SELECT c0, sum(c1), min(c6) FROM tmp GROUP BY c0");
+}
+
 TEST_F(AggregationTest, aggregateOfNulls) {
   auto rowType = ROW({"c0", "c1"}, {BIGINT(), SMALLINT()});
 
@@ -686,6 +745,36 @@ TEST_F(AggregationTest, partialAggregationMemoryLimit) {
           .customStats.count("flushRowCount"));
 }
 
+TEST_F(AggregationTest, abandonPartialAggregation) {
+  // Unique keys: the partial aggregation reduces nothing and is
+  // abandoned after the first flush, after which each batch flushes
+  // through with results unchanged.
+  std::vector<RowVectorPtr> vectors;
+  for (auto batch = 0; batch < 5; ++batch) {
+    vectors.push_back(makeRowVector({makeFlatVector<int64_t>(
+        1'000, [&](auto row) { return batch * 1'000 + row; })}));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId aggNodeId;
+  auto task = AssertQueryBuilder(duckDbQueryRunner_)
+                  .config(QueryConfig::kMaxPartialAggregationMemory, "1")
+                  .config(QueryConfig::kAbandonPartialAggregationMinRows, "100")
+                  .config(QueryConfig::kAbandonPartialAggregationMinPct, "50")
+                  .plan(PlanBuilder()
+                            .values(vectors)
+                            .partialAggregation({"c0"}, {"count(1)"})
+                            .capturePlanNodeId(aggNodeId)
+                            .finalAggregation()
+                            .planNode())
+                  .assertResults("SELECT c0, count(1) FROM tmp GROUP BY 1");
+  EXPECT_EQ(
+      1,
+      toPlanStats(task->taskStats())
+          .at(aggNodeId)
+          .customStats.count("abandonedPartialAggregation"));
+}
+
 TEST_F(AggregationTest, partialAggregationMemoryLimitIncrease) {
   constexpr int64_t kGB = 1 << 30;
   constexpr int64_t kB = 1 << 10;
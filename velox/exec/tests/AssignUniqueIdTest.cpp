@@ -103,6 +103,37 @@ TEST_F(AssignUniqueIdTest, exceedRequestLimit) {
   verifyUniqueId(plan, input);
 }
 
+TEST_F(AssignUniqueIdTest, midBlockRefill) {
+  // The second batch crosses the end of the ID block leased during the first
+  // one. The IDs emitted around the refill must not overlap the next block.
+  std::vector<RowVectorPtr> input = {
+      makeRowVector(
+          {makeFlatVector<int32_t>(1000, [](auto row) { return row; })}),
+      makeRowVector(
+          {makeFlatVector<int32_t>(10'000, [](auto row) { return row; })})};
+
+  auto plan = PlanBuilder()
+                  .values(input)
+                  .assignUniqueId()
+                  .capturePlanNodeId(uniqueNodeId_)
+                  .planNode();
+
+  CursorParameters params;
+  params.planNode = plan;
+  auto result = readCursor(params, [](auto /*task*/) {});
+
+  std::set<int64_t> ids;
+  vector_size_t numRows = 0;
+  for (const auto& output : result.second) {
+    auto idValues =
+        output->children().back()->asFlatVector<int64_t>()->rawValues();
+    ids.insert(idValues, idValues + output->size());
+    numRows += output->size();
+  }
+  ASSERT_EQ(11000, numRows);
+  ASSERT_EQ(numRows, ids.size());
+}
+
 TEST_F(AssignUniqueIdTest, multiThread) {
   for (int i = 0; i < 3; i++) {
     vector_size_t batchSize = 1000;
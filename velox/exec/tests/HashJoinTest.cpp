@@ -2992,4 +2992,131 @@ TEST_F(HashJoinTest, smallOutputBatchSize) {
       .referenceQuery("SELECT c0, u_c1 FROM t, u WHERE c0 = u_c0 AND c1 < u_c1")
       .run();
 }
+
+TEST_F(HashJoinTest, manyDuplicateBuildRows) {
+  // Every build key repeats hundreds of times, so the duplicate chains
+  // are packed into contiguous row pointer lists at table finalization
+  // and the probe emits them via array scans, including across output
+  // batch boundaries (small preferred batch size).
+  auto probeVectors = makeRowVector({
+      makeFlatVector<int32_t>(100, [](auto row) { return row % 5; }),
+  });
+
+  auto buildVectors = makeRowVector(
+      {"u_c0", "u_c1"},
+      {
+          makeFlatVector<int32_t>(1'000, [](auto row) { return row % 3; }),
+          makeFlatVector<int32_t>(1'000, [](auto row) { return row; }),
+      });
+
+  createDuckDbTable("t", {probeVectors});
+  createDuckDbTable("u", {buildVectors});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .values({probeVectors})
+                  .hashJoin(
+                      {"c0"},
+                      {"u_c0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values({buildVectors})
+                          .planNode(),
+                      "",
+                      {"c0", "u_c1"})
+                  .planNode();
+
+  HashJoinBuilder(*pool_, duckDbQueryRunner_)
+      .planNode(std::move(plan))
+      .config(core::QueryConfig::kPreferredOutputBatchSize, std::to_string(64))
+      .referenceQuery("SELECT c0, u_c1 FROM t, u WHERE c0 = u_c0")
+      .run();
+}
+
+TEST_F(HashJoinTest, duplicateChainBeyondPackingCap) {
+  // Key 0 repeats more times than a packed list may hold (the list must
+  // fit one arena slab run), so its chain keeps the linked
+  // representation, while key 1's chain is packed; both emit correctly
+  // from the same table.
+  constexpr vector_size_t kHotKeyRows = 140'000;
+  auto buildVectors = makeRowVector(
+      {"u_c0", "u_c1"},
+      {
+          makeFlatVector<int32_t>(
+              kHotKeyRows + 100,
+              [](auto row) { return row < kHotKeyRows ? 0 : 1; }),
+          makeFlatVector<int32_t>(
+              kHotKeyRows + 100, [](auto row) { return row; }),
+      });
+
+  auto probeVectors = makeRowVector({
+      makeFlatVector<int32_t>({0, 1}),
+  });
+
+  createDuckDbTable("t", {probeVectors});
+  createDuckDbTable("u", {buildVectors});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .values({probeVectors})
+                  .hashJoin(
+                      {"c0"},
+                      {"u_c0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values({buildVectors})
+                          .planNode(),
+                      "",
+                      {"c0", "u_c1"})
+                  .planNode();
+
+  HashJoinBuilder(*pool_, duckDbQueryRunner_)
+      .planNode(std::move(plan))
+      .referenceQuery("SELECT c0, u_c1 FROM t, u WHERE c0 = u_c0")
+      .run();
+}
+
+TEST_F(HashJoinTest, radixPartitionedBuild) {
+  // Build side large enough to pass the minimum per-partition size of the
+  // parallel build, built by multiple drivers.
+  std::vector<RowVectorPtr> probeVectors;
+  for (auto i = 0; i < 4; ++i) {
+    probeVectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(1000, [](auto row) { return row % 7000; }),
+        makeFlatVector<int64_t>(1000, [](auto row) { return row; }),
+    }));
+  }
+  std::vector<RowVectorPtr> buildVectors;
+  for (auto i = 0; i < 4; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"u_c0", "u_c1"},
+        {
+            makeFlatVector<int64_t>(
+                2000, [i](auto row) { return i * 2000 + row; }),
+            makeFlatVector<int64_t>(2000, [](auto row) { return row * 10; }),
+        }));
+  }
+
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .values(probeVectors, true)
+                  .hashJoin(
+                      {"c0"},
+                      {"u_c0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values(buildVectors, true)
+                          .planNode(),
+                      "",
+                      {"c0", "u_c1"},
+                      core::JoinType::kInner,
+                      true /*radixPartitionedBuild*/)
+                  .planNode();
+
+  HashJoinBuilder(*pool_, duckDbQueryRunner_)
+      .planNode(std::move(plan))
+      .numDrivers(4)
+      .referenceQuery("SELECT t.c0, u.u_c1 FROM t, u WHERE t.c0 = u.u_c0")
+      .run();
+}
 } // namespace
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 
@@ -64,6 +65,39 @@ TEST_F(LimitTest, basic) {
   assertQueryReturnsEmptyResult(makePlan(12'345, 10));
 }
 
+TEST_F(LimitTest, rowBudgetPushdownToScan) {
+  auto data = makeRowVector(
+      {makeFlatVector<int32_t>(1'000, [](auto row) { return row; })});
+
+  auto file = TempFilePath::create();
+  writeToFile(file->path, {data});
+
+  core::PlanNodeId scanNodeId;
+
+  CursorParameters params;
+  params.planNode = PlanBuilder()
+                        .tableScan(asRowType(data->type()))
+                        .capturePlanNodeId(scanNodeId)
+                        .limit(0, 20, false)
+                        .planNode();
+
+  TaskCursor cursor(params);
+  cursor.task()->addSplit(
+      scanNodeId, exec::Split(makeHiveConnectorSplit(file->path)));
+  cursor.task()->noMoreSplits(scanNodeId);
+
+  int32_t numRead = 0;
+  while (cursor.moveNext()) {
+    numRead += cursor.current()->size();
+  }
+  ASSERT_EQ(20, numRead);
+
+  // The Limit publishes its row budget to the driver; the scan must not
+  // read past it.
+  auto stats = toPlanStats(cursor.task()->taskStats());
+  ASSERT_EQ(20, stats.at(scanNodeId).outputRows);
+}
+
 TEST_F(LimitTest, limitOverLocalExchange) {
   auto data = makeRowVector(
       {makeFlatVector<int32_t>(1'000, [](auto row) { return row; })});
@@ -190,6 +190,35 @@ TEST_F(LocalPartitionTest, partition) {
   verifyExchangeSourceOperatorStats(task, 300);
 }
 
+TEST_F(LocalPartitionTest, skewRebalance) {
+  // All rows share one hot key. With mayRebalanceSkew the exchange may
+  // spread slices of the hot partition across consumers once its queue
+  // backs up; the partial aggregation below tolerates equal keys in
+  // multiple partitions and the final aggregation merges the duplicate
+  // groups, so results are unchanged.
+  std::vector<RowVectorPtr> vectors = {
+      makeRowVector({makeFlatVector<int32_t>(1'000, [](auto) { return 7; })}),
+  };
+  createDuckDbTable(vectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .localPartition(
+                      {"c0"},
+                      {PlanBuilder(planNodeIdGenerator)
+                           .values(vectors, true)
+                           .planNode()},
+                      true)
+                  .partialAggregation({"c0"}, {"count(1)"})
+                  .localPartition({})
+                  .finalAggregation()
+                  .planNode();
+
+  AssertQueryBuilder queryBuilder(plan, duckDbQueryRunner_);
+  queryBuilder.maxDrivers(4);
+  queryBuilder.assertResults("SELECT c0, count(1) * 4 FROM tmp GROUP BY 1");
+}
+
 TEST_F(LocalPartitionTest, maxBufferSizeGather) {
   std::vector<RowVectorPtr> vectors;
   for (auto i = 0; i < 21; i++) {
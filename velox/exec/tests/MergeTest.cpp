@@ -33,12 +33,9 @@ class MergeTest : public OperatorTestBase {
       const auto orderByClause = fmt::format("{} {}", key, sortOrderSql);
       auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
       auto plan = PlanBuilder(planNodeIdGenerator)
-                      .localMerge(
-                          {orderByClause},
-                          {PlanBuilder(planNodeIdGenerator)
-                               .values(inputVectors, true)
-                               .orderBy({orderByClause}, true)
-                               .planNode()})
+                      .values(inputVectors, true)
+                      .orderBy({orderByClause}, true)
+                      .localMerge({orderByClause})
                       .planNode();
 
       CursorParameters params;
@@ -151,6 +148,33 @@ TEST_F(MergeTest, localMerge) {
   testTwoKeys(vectors, "c3", "c0");
 }
 
+TEST_F(MergeTest, disjointRanges) {
+  // Sources with non-overlapping key ranges exercise the whole-batch
+  // passthrough in Merge::getOutput: each source's batches win outright
+  // against the runner-up and transfer without row-by-row merging.
+  vector_size_t batchSize = 1'000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 4; ++i) {
+    vectors.push_back(makeRowVector({makeFlatVector<int64_t>(
+        batchSize, [&](auto row) { return batchSize * i + row; })}));
+  }
+  createDuckDbTable(vectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  std::vector<std::shared_ptr<const core::PlanNode>> sources;
+  for (const auto& input : vectors) {
+    sources.push_back(PlanBuilder(planNodeIdGenerator)
+                          .values({input})
+                          .orderBy({"c0"}, true)
+                          .planNode());
+  }
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .localMerge({"c0"}, std::move(sources))
+                  .planNode();
+
+  assertQueryOrdered(plan, "SELECT * FROM tmp ORDER BY c0", {0});
+}
+
 /// Verifies an edge case where output batch fills up when one of the sources
 /// has only one row left.
 TEST_F(MergeTest, offByOne) {
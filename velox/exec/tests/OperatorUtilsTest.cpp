@@ -15,6 +15,7 @@
  */
 #include "velox/exec/OperatorUtils.h"
 #include <gtest/gtest.h>
+#include <unordered_set>
 #include "velox/dwio/common/tests/utils/BatchMaker.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
@@ -206,6 +207,20 @@ TEST_F(OperatorUtilsTest, gatherCopy) {
 
 TEST_F(OperatorUtilsTest, makeOperatorSpillPath) {
   EXPECT_EQ("spill/task_1_100", makeOperatorSpillPath("spill", "task", 1, 100));
+
+  // A comma separated list of paths stripes operators across the entries.
+  std::unordered_set<std::string> used;
+  for (auto driverId = 0; driverId < 64; ++driverId) {
+    auto path = makeOperatorSpillPath("d0,d1,d2,d3", "task", driverId, 100);
+    EXPECT_EQ(fmt::format("/task_{}_100", driverId), path.substr(2));
+    used.insert(path.substr(0, 2));
+  }
+  EXPECT_EQ(4, used.size());
+
+  // The choice is deterministic for one operator.
+  EXPECT_EQ(
+      makeOperatorSpillPath("d0,d1,d2,d3", "task", 7, 100),
+      makeOperatorSpillPath("d0,d1,d2,d3", "task", 7, 100));
 }
 
 TEST_F(OperatorUtilsTest, wrap) {
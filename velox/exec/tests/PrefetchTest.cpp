@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/tests/utils/HiveConnectorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec::test;
+
+class PrefetchTest : public HiveConnectorTestBase {};
+
+TEST_F(PrefetchTest, basic) {
+  vector_size_t batchSize = 1'000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 10; ++i) {
+    auto c0 = makeFlatVector<int64_t>(
+        batchSize, [&](auto row) { return batchSize * i + row; }, nullEvery(5));
+    auto c1 = makeFlatVector<double>(
+        batchSize, [](auto row) { return row * 0.1; }, nullEvery(11));
+    vectors.push_back(makeRowVector({c0, c1}));
+  }
+  createDuckDbTable(vectors);
+
+  auto plan = PlanBuilder().values(vectors).prefetch(3).planNode();
+  assertQuery(plan, "SELECT * FROM tmp");
+}
+
+TEST_F(PrefetchTest, overTableScan) {
+  auto data = makeRowVector(
+      {makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+       makeFlatVector<double>(10'000, [](auto row) { return row * 0.1; })});
+
+  auto file = TempFilePath::create();
+  writeToFile(file->path, {data});
+  createDuckDbTable({data});
+
+  auto plan = PlanBuilder()
+                  .tableScan(asRowType(data->type()))
+                  .prefetch(4)
+                  .singleAggregation({}, {"sum(c0)", "sum(c1)"})
+                  .planNode();
+
+  // Lazy columns buffered by Prefetch are loaded on the Task's executor.
+  assertQuery(
+      plan,
+      {makeHiveConnectorSplit(file->path)},
+      "SELECT sum(c0), sum(c1) FROM tmp");
+}
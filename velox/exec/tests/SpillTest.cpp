@@ -61,7 +61,8 @@ class SpillTest : public testing::Test,
       int numBatches,
       int numRowsPerBatch = 1000,
       int numDuplicates = 1,
-      const std::vector<CompareFlags>& compareFlags = {}) {
+      const std::vector<CompareFlags>& compareFlags = {},
+      const std::string& compressionCodec = "none") {
     ASSERT_TRUE(compareFlags.empty() || compareFlags.size() == 1);
     ASSERT_EQ(numBatches % 2, 0);
 
@@ -121,7 +122,8 @@ class SpillTest : public testing::Test,
         compareFlags,
         targetFileSize,
         *pool(),
-        *mappedMemory_);
+        *mappedMemory_,
+        compressionCodec);
     EXPECT_EQ(targetFileSize, state_->targetFileSize());
     EXPECT_EQ(numPartitions, state_->maxPartitions());
     EXPECT_EQ(0, state_->spilledPartitions());
@@ -193,7 +195,8 @@ class SpillTest : public testing::Test,
       int numBatches,
       int numDuplicates,
       const std::vector<CompareFlags>& compareFlags,
-      int64_t expectedNumSpilledFiles) {
+      int64_t expectedNumSpilledFiles,
+      const std::string& compressionCodec = "none") {
     const int numRowsPerBatch = 20'000;
     SCOPED_TRACE(fmt::format(
         "targetFileSize: {}, numPartitions: {}, numBatches: {}, numDuplicates: {}, nullsFirst: {}, ascending: {}",
@@ -209,7 +212,8 @@ class SpillTest : public testing::Test,
         numBatches,
         numRowsPerBatch,
         numDuplicates,
-        compareFlags);
+        compareFlags,
+        compressionCodec);
 
     ASSERT_EQ(expectedNumSpilledFiles, state_->spilledFiles());
     std::vector<std::string> spilledFiles = state_->testingSpilledFilePaths();
@@ -281,6 +285,12 @@ class SpillTest : public testing::Test,
   std::unique_ptr<SpillState> state_;
 };
 
+TEST_F(SpillTest, spillStateCompressed) {
+  // Compressed spill files round-trip through the merge readers.
+  spillStateTest(kGB, 2, 10, 1, {CompareFlags{true, true}}, 10, "zstd");
+  spillStateTest(kGB, 2, 10, 10, {}, 10, "lz4");
+}
+
 TEST_F(SpillTest, spillState) {
   // Set the target file size to a large value to avoid new file creation
   // triggered by batch write.
@@ -1707,6 +1707,16 @@ TEST_F(TableScanTest, aggregationPushdown) {
   // 5 aggregates processing 10K rows each via pushdown.
   EXPECT_EQ(5 * 10'000, loadedToValueHook(task));
 
+  op = PlanBuilder()
+           .tableScan(rowType_)
+           .singleAggregation({"c5"}, {"count(c0)", "count(c1)"})
+           .planNode();
+
+  task = assertQuery(
+      op, {filePath}, "SELECT c5, count(c0), count(c1) FROM tmp group by c5");
+  // 2 count aggregates processing 10K rows each via pushdown.
+  EXPECT_EQ(2 * 10'000, loadedToValueHook(task));
+
   // Pushdown should also happen if there is a FilterProject node that doesn't
   // touch columns being aggregated
   op = PlanBuilder()
@@ -303,6 +303,47 @@ TEST_F(VectorHasherTest, dictionary) {
   }
 }
 
+TEST_F(VectorHasherTest, hashMemo) {
+  // Two hashers sharing a memo reuse base value hashes computed by the
+  // first one.
+  auto vector = vectorMaker_->flatVector<int64_t>(
+      10, [](vector_size_t row) { return row + 3; });
+
+  BufferPtr indices = AlignedBuffer::allocate<vector_size_t>(100, pool_.get());
+  auto indicesPtr = indices->asMutable<vector_size_t>();
+  for (int32_t i = 0; i < 100; i++) {
+    indicesPtr[i] = i % 10;
+  }
+  VectorPtr dictionaryVector =
+      BaseVector::wrapInDictionary(BufferPtr(nullptr), indices, 100, vector);
+
+  exec::VectorHashMemo memo;
+  auto hasher1 = exec::VectorHasher::create(BIGINT(), 1);
+  auto hasher2 = exec::VectorHasher::create(BIGINT(), 1);
+  hasher1->setHashMemo(&memo);
+  hasher2->setHashMemo(&memo);
+
+  raw_vector<uint64_t> hashes(100);
+  hasher1->decode(dictionaryVector, allRows_);
+  hasher1->hash(allRows_, false, hashes);
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(hashes[i], folly::hasher<int64_t>()(i % 10 + 3)) << "at " << i;
+  }
+
+  // Overwrite the base values. The second hasher sees the memoized
+  // hashes of the original values, proving it did not re-hash the base.
+  auto original = folly::hasher<int64_t>()(3);
+  vector->asFlatVector<int64_t>()->set(0, 1'000'000);
+  hasher2->decode(dictionaryVector, allRows_);
+  hasher2->hash(allRows_, false, hashes);
+  EXPECT_EQ(hashes[0], original);
+
+  // Without the memo the new value is hashed.
+  hasher2->setHashMemo(nullptr);
+  hasher2->hash(allRows_, false, hashes);
+  EXPECT_EQ(hashes[0], folly::hasher<int64_t>()(1'000'000));
+}
+
 // Tests how strings are mapped to uint64_t (if they fit) and to
 // consecutive ids of distinct values for the general case.
 TEST_F(VectorHasherTest, stringIds) {
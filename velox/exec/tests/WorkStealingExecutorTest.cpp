@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/WorkStealingExecutor.h"
+
+#include <folly/synchronization/Baton.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::velox::exec;
+
+TEST(WorkStealingExecutorTest, basic) {
+  WorkStealingExecutor executor(4);
+  std::atomic<int32_t> count{0};
+  constexpr int32_t kNumTasks = 1000;
+  folly::Baton<> done;
+  for (auto i = 0; i < kNumTasks; ++i) {
+    executor.add([&]() {
+      if (++count == kNumTasks) {
+        done.post();
+      }
+    });
+  }
+  ASSERT_TRUE(done.try_wait_for(std::chrono::seconds(10)));
+  EXPECT_EQ(kNumTasks, count);
+  executor.join();
+  EXPECT_EQ(0, executor.queuedCount());
+}
+
+TEST(WorkStealingExecutorTest, stealsFromBusyPeer) {
+  // One long-running item must not delay the items queued behind it on
+  // the same worker: peers steal them.
+  WorkStealingExecutor executor(2);
+  folly::Baton<> blockerStarted;
+  folly::Baton<> release;
+  std::atomic<int32_t> count{0};
+  folly::Baton<> done;
+  executor.add([&]() {
+    blockerStarted.post();
+    release.wait();
+  });
+  ASSERT_TRUE(blockerStarted.try_wait_for(std::chrono::seconds(10)));
+  constexpr int32_t kNumTasks = 100;
+  for (auto i = 0; i < kNumTasks; ++i) {
+    executor.add([&]() {
+      if (++count == kNumTasks) {
+        done.post();
+      }
+    });
+  }
+  // All short items complete while the blocker still occupies its thread.
+  ASSERT_TRUE(done.try_wait_for(std::chrono::seconds(10)));
+  EXPECT_EQ(kNumTasks, count);
+  release.post();
+  executor.join();
+}
+
+TEST(WorkStealingExecutorTest, recursiveAdd) {
+  // Work added from a worker thread goes to the worker's own deque and
+  // still runs.
+  WorkStealingExecutor executor(2);
+  std::atomic<int32_t> count{0};
+  folly::Baton<> done;
+  executor.add([&]() {
+    for (auto i = 0; i < 10; ++i) {
+      executor.add([&]() {
+        if (++count == 10) {
+          done.post();
+        }
+      });
+    }
+  });
+  ASSERT_TRUE(done.try_wait_for(std::chrono::seconds(10)));
+  EXPECT_EQ(10, count);
+}
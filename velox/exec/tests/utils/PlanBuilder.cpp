@@ -669,6 +669,29 @@ PlanBuilder& PlanBuilder::localMerge(
   return *this;
 }
 
+PlanBuilder& PlanBuilder::localMerge(const std::vector<std::string>& keys) {
+  VELOX_CHECK_NOT_NULL(
+      planNode_, "localMerge() over the current node requires a source");
+
+  auto [sortingKeys, sortingOrders] =
+      parseOrderByClauses(keys, planNode_->outputType(), pool_);
+  planNode_ = std::make_shared<core::LocalMergeNode>(
+      nextPlanNodeId(),
+      sortingKeys,
+      sortingOrders,
+      std::vector<core::PlanNodePtr>{planNode_});
+
+  return *this;
+}
+
+PlanBuilder& PlanBuilder::localShuffle(const std::vector<std::string>& keys) {
+  VELOX_CHECK_NOT_NULL(planNode_, "localShuffle() requires a source");
+  if (keys.empty()) {
+    return localPartitionRoundRobin();
+  }
+  return localPartition(keys);
+}
+
 PlanBuilder& PlanBuilder::orderBy(
     const std::vector<std::string>& keys,
     bool isPartial) {
@@ -703,6 +726,12 @@ PlanBuilder& PlanBuilder::limit(int32_t offset, int32_t count, bool isPartial) {
   return *this;
 }
 
+PlanBuilder& PlanBuilder::prefetch(int32_t numBatches) {
+  planNode_ = std::make_shared<core::PrefetchNode>(
+      nextPlanNodeId(), numBatches, planNode_);
+  return *this;
+}
+
 PlanBuilder& PlanBuilder::enforceSingleRow() {
   planNode_ =
       std::make_shared<core::EnforceSingleRowNode>(nextPlanNodeId(), planNode_);
@@ -777,7 +806,8 @@ RowTypePtr rename(
 core::PlanNodePtr createLocalPartitionNode(
     const core::PlanNodeId& planNodeId,
     const std::vector<std::string>& keys,
-    const std::vector<core::PlanNodePtr>& sources) {
+    const std::vector<core::PlanNodePtr>& sources,
+    bool mayRebalanceSkew) {
   auto partitionFunctionFactory =
       createPartitionFunctionFactory(sources[0]->outputType(), keys);
   return std::make_shared<core::LocalPartitionNode>(
@@ -785,7 +815,8 @@ core::PlanNodePtr createLocalPartitionNode(
       keys.empty() ? core::LocalPartitionNode::Type::kGather
                    : core::LocalPartitionNode::Type::kRepartition,
       partitionFunctionFactory,
-      sources);
+      sources,
+      mayRebalanceSkew);
 }
 } // namespace
 
@@ -830,14 +861,19 @@ PlanBuilder& PlanBuilder::partitionedOutputBroadcast(
 
 PlanBuilder& PlanBuilder::localPartition(
     const std::vector<std::string>& keys,
-    const std::vector<core::PlanNodePtr>& sources) {
+    const std::vector<core::PlanNodePtr>& sources,
+    bool mayRebalanceSkew) {
   VELOX_CHECK_NULL(planNode_, "localPartition() must be the first call");
-  planNode_ = createLocalPartitionNode(nextPlanNodeId(), keys, sources);
+  planNode_ = createLocalPartitionNode(
+      nextPlanNodeId(), keys, sources, mayRebalanceSkew);
   return *this;
 }
 
-PlanBuilder& PlanBuilder::localPartition(const std::vector<std::string>& keys) {
-  planNode_ = createLocalPartitionNode(nextPlanNodeId(), keys, {planNode_});
+PlanBuilder& PlanBuilder::localPartition(
+    const std::vector<std::string>& keys,
+    bool mayRebalanceSkew) {
+  planNode_ = createLocalPartitionNode(
+      nextPlanNodeId(), keys, {planNode_}, mayRebalanceSkew);
   return *this;
 }
 
@@ -877,7 +913,8 @@ PlanBuilder& PlanBuilder::hashJoin(
     const core::PlanNodePtr& build,
     const std::string& filter,
     const std::vector<std::string>& outputLayout,
-    core::JoinType joinType) {
+    core::JoinType joinType,
+    bool radixPartitionedBuild) {
   VELOX_CHECK_EQ(leftKeys.size(), rightKeys.size());
 
   auto leftType = planNode_->outputType();
@@ -899,7 +936,8 @@ PlanBuilder& PlanBuilder::hashJoin(
       std::move(filterExpr),
       std::move(planNode_),
       build,
-      outputType);
+      outputType,
+      radixPartitionedBuild);
   return *this;
 }
 
@@ -450,6 +450,19 @@ class PlanBuilder {
       const std::vector<std::string>& keys,
       std::vector<core::PlanNodePtr> sources);
 
+  /// A convenience method to add a LocalMergeNode over the current plan
+  /// node: merges the sorted streams of the pipeline's drivers into one
+  /// sorted stream. The upstream pipeline must produce streams sorted
+  /// on 'keys', e.g. via orderBy(keys, true).
+  PlanBuilder& localMerge(const std::vector<std::string>& keys);
+
+  /// Adds the local exchange an embedded multi-pipeline plan needs to
+  /// parallelize or re-key the downstream pipeline: hash-partitions on
+  /// 'keys', or redistributes round-robin when 'keys' is empty, so
+  /// downstream runs with multiple drivers without key co-location
+  /// hand-assembly.
+  PlanBuilder& localShuffle(const std::vector<std::string>& keys);
+
   /// Adds an OrderByNode using specified ORDER BY clauses.
   ///
   /// For example,
@@ -481,6 +494,12 @@ class PlanBuilder {
   /// single-threaded.
   PlanBuilder& limit(int32_t offset, int32_t count, bool isPartial);
 
+  /// Add a PrefetchNode to buffer batches produced by the source and load
+  /// their lazy columns ahead of the consumer.
+  ///
+  /// @param numBatches Maximum number of batches buffered ahead.
+  PlanBuilder& prefetch(int32_t numBatches);
+
   /// Add an EnforceSingleRowNode to ensure input has at most one row at
   /// runtime.
   PlanBuilder& enforceSingleRow();
@@ -540,13 +559,19 @@ class PlanBuilder {
   /// @param keys Partitioning keys. May be empty, in which case all input will
   /// be places in a single partition.
   /// @param sources One or more plan nodes that produce input data.
+  /// @param mayRebalanceSkew True if the consumer tolerates rows of one key
+  /// landing in multiple partitions, allowing runtime skew rebalancing. See
+  /// core::LocalPartitionNode::mayRebalanceSkew().
   PlanBuilder& localPartition(
       const std::vector<std::string>& keys,
-      const std::vector<core::PlanNodePtr>& sources);
+      const std::vector<core::PlanNodePtr>& sources,
+      bool mayRebalanceSkew = false);
 
   /// A convenience method to add a LocalPartitionNode with a single source (the
   /// current plan node).
-  PlanBuilder& localPartition(const std::vector<std::string>& keys);
+  PlanBuilder& localPartition(
+      const std::vector<std::string>& keys,
+      bool mayRebalanceSkew = false);
 
   /// Add a LocalPartitionNode to partition the input using row-wise
   /// round-robin. Number of partitions is determined at runtime based on
@@ -575,13 +600,16 @@ class PlanBuilder {
   /// @param outputLayout Output layout consisting of columns from probe and
   /// build sides.
   /// @param joinType Type of the join: inner, left, right, full, semi, or anti.
+  /// @param radixPartitionedBuild If true, the join table is built
+  /// partition-parallel from hash-partitioned build side rows.
   PlanBuilder& hashJoin(
       const std::vector<std::string>& leftKeys,
       const std::vector<std::string>& rightKeys,
       const core::PlanNodePtr& build,
       const std::string& filter,
       const std::vector<std::string>& outputLayout,
-      core::JoinType joinType = core::JoinType::kInner);
+      core::JoinType joinType = core::JoinType::kInner,
+      bool radixPartitionedBuild = false);
 
   /// Add a MergeJoinNode to join two inputs using one or more join keys and an
   /// optional filter. The caller is responsible to ensure that inputs are
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares generated and interpreted execution over representative
+// workload expression shapes (arithmetic chains, conditionals, string
+// transforms) and reports speedup, compile time and the break-even
+// evaluation count as JSON on stdout. The numbers feed the decision of
+// where a JIT tier should engage.
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+#include <folly/dynamic.h>
+#include <folly/init/Init.h>
+#include <folly/json.h>
+
+#include "velox/experimental/codegen/CodegenCompiledExpressionTransform.h"
+#include "velox/experimental/codegen/benchmark/CodegenBenchmark.h"
+
+namespace facebook::velox::codegen {
+namespace {
+
+class WorkloadShapesBenchmark : public CodegenBenchmark {
+ public:
+  static constexpr int32_t kRunsPerMeasurement = 5;
+
+  /// Prepares 'projections' over 'inputRowType', measures compile time,
+  /// interpreted and generated per-row cost and appends one JSON record.
+  template <typename... SQLType>
+  void run(
+      const std::string& name,
+      const std::vector<std::string>& projections,
+      const std::shared_ptr<const RowType>& inputRowType,
+      size_t batchCount,
+      size_t rowsPerBatch) {
+    auto benchmarkIndex = prepareBenchmarkInfo<SQLType...>(
+        name,
+        "",
+        projections,
+        inputRowType,
+        batchCount,
+        rowsPerBatch,
+        defaultFlags);
+    auto& info = benchmarkInfos[benchmarkIndex];
+
+    // Compile time: transform the reference plan again so that the
+    // measurement covers code generation and compilation only, not the
+    // input materialization done by the preparation above.
+    const auto compileStart = Clock::now();
+    codegenTransformation_->setTransformFlags(defaultFlags);
+    auto recompiled = codegenTransformation_->transform(*info.refPlanNodes);
+    const double compileUs = microsSince(compileStart);
+
+    const double referenceUs = bestOfRuns([&]() {
+      info.referenceResults.clear();
+      info.clearStringEncoding();
+      info.referenceResults =
+          runQuery(info.refPlanNodes, info.referenceTaskCursors);
+    });
+
+    const double compiledUs = bestOfRuns([&]() {
+      info.compiledResults.clear();
+      info.clearStringEncoding();
+      info.compiledResults =
+          runQuery(info.compiledPlanNodes, info.compiledTaskCursors);
+    });
+
+    const double numRows = batchCount * rowsPerBatch;
+    const double gainPerRowUs = (referenceUs - compiledUs) / numRows;
+
+    folly::dynamic record = folly::dynamic::object;
+    record["name"] = name;
+    record["expressions"] =
+        folly::dynamic::array(projections.begin(), projections.end());
+    record["rows"] = numRows;
+    record["compileTimeUs"] = compileUs;
+    record["interpretedUsPerRow"] = referenceUs / numRows;
+    record["generatedUsPerRow"] = compiledUs / numRows;
+    record["speedup"] = compiledUs > 0 ? referenceUs / compiledUs : 0;
+    // Number of row evaluations after which compilation pays for
+    // itself; -1 when the generated code does not win.
+    record["breakEvenRows"] =
+        gainPerRowUs > 0 ? compileUs / gainPerRowUs : -1.0;
+    records_.push_back(std::move(record));
+  }
+
+  void printJson() const {
+    folly::dynamic doc = folly::dynamic::object;
+    doc["benchmarks"] = folly::dynamic::array(records_.begin(), records_.end());
+    std::cout << folly::toPrettyJson(doc) << std::endl;
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  static double microsSince(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               Clock::now() - start)
+        .count();
+  }
+
+  // Returns the best wall time of kRunsPerMeasurement runs of 'func',
+  // in microseconds.
+  template <typename Func>
+  static double bestOfRuns(Func&& func) {
+    double best = std::numeric_limits<double>::max();
+    for (auto i = 0; i < kRunsPerMeasurement; ++i) {
+      const auto start = Clock::now();
+      func();
+      best = std::min(best, microsSince(start));
+    }
+    return best;
+  }
+
+  std::vector<folly::dynamic> records_;
+};
+
+} // namespace
+} // namespace facebook::velox::codegen
+
+using namespace facebook::velox;
+using namespace facebook::velox::codegen;
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv);
+
+  WorkloadShapesBenchmark benchmark;
+
+  constexpr size_t kBatches = 100;
+  constexpr size_t kRowsPerBatch = 10'000;
+
+  // Arithmetic chains of growing depth.
+  auto doubles =
+      ROW({"a", "b", "c", "d"},
+          std::vector<TypePtr>{DOUBLE(), DOUBLE(), DOUBLE(), DOUBLE()});
+  benchmark.run<DoubleType>(
+      "arithChain2", {"a + b"}, doubles, kBatches, kRowsPerBatch);
+  benchmark.run<DoubleType>(
+      "arithChain4", {"a + b - c * d"}, doubles, kBatches, kRowsPerBatch);
+  benchmark.run<DoubleType>(
+      "arithChain8",
+      {"(a + b) * (c - d) + (a - c) * (b + d)"},
+      doubles,
+      kBatches,
+      kRowsPerBatch);
+
+  // Conditionals over booleans and arithmetic branches.
+  auto mixed =
+      ROW({"a", "b", "d", "e"},
+          std::vector<TypePtr>{BOOLEAN(), BOOLEAN(), DOUBLE(), DOUBLE()});
+  benchmark.run<DoubleType>(
+      "conditionalSimple",
+      {"if(a and b, 1.1, 1.2)"},
+      mixed,
+      kBatches,
+      kRowsPerBatch);
+  benchmark.run<DoubleType>(
+      "conditionalArith",
+      {"if(a, d + 1.0, e + 2.0)"},
+      mixed,
+      kBatches,
+      kRowsPerBatch);
+
+  // String transforms.
+  auto strings =
+      ROW({"str1", "str2"}, std::vector<TypePtr>{VARCHAR(), VARCHAR()});
+  benchmark.run<VarcharType>(
+      "stringUpper", {"upper(str1)"}, strings, kBatches, kRowsPerBatch);
+  benchmark.run<VarcharType>(
+      "stringCoalesceLowerUpper",
+      {"\"coalesce\"(upper(str1), lower(str2))"},
+      strings,
+      kBatches,
+      kRowsPerBatch);
+
+  benchmark.printJson();
+  return 0;
+}
@@ -19,6 +19,7 @@
 #include <stdexcept>
 
 #include <fmt/format.h>
+#include <folly/Conv.h>
 
 #include <velox/common/base/VeloxException.h>
 #include "velox/common/base/Exceptions.h"
@@ -76,6 +77,50 @@ void applyCastKernel(
   }
 }
 
+/// Casts integers to their decimal string representation for all rows
+/// at once: a first pass computes per-row digit counts to size a single
+/// string buffer, a second pass writes the digits. Integer to varchar
+/// never fails and does not depend on the truncate flag, so there is no
+/// per-row error handling.
+template <typename From>
+void applyIntToVarcharCast(
+    const SelectivityVector& rows,
+    const BaseVector& input,
+    FlatVector<StringView>* resultFlatVector) {
+  if (!rows.hasSelections()) {
+    return;
+  }
+  auto* inputVector = input.asUnchecked<SimpleVector<From>>();
+
+  uint64_t totalBytes = 0;
+  rows.applyToSelected([&](vector_size_t row) {
+    const auto value = inputVector->valueAt(row);
+    const uint64_t unsignedValue = value < 0
+        ? 0 - static_cast<uint64_t>(value)
+        : static_cast<uint64_t>(value);
+    totalBytes += folly::digits10(unsignedValue) + (value < 0 ? 1 : 0);
+  });
+
+  auto* buffer = resultFlatVector->getBufferWithSpace(totalBytes);
+  char* writePosition = buffer->asMutable<char>() + buffer->size();
+  buffer->setSize(buffer->size() + totalBytes);
+
+  resultFlatVector->clearNulls(rows);
+  auto* rawValues = resultFlatVector->mutableRawValues();
+  rows.applyToSelected([&](vector_size_t row) {
+    const auto value = inputVector->valueAt(row);
+    char* start = writePosition;
+    if (value < 0) {
+      *writePosition++ = '-';
+    }
+    const uint64_t unsignedValue = value < 0
+        ? 0 - static_cast<uint64_t>(value)
+        : static_cast<uint64_t>(value);
+    writePosition += folly::uint64ToBufferUnsafe(unsignedValue, writePosition);
+    rawValues[row] = StringView(start, writePosition - start);
+  });
+}
+
 void populateNestedRows(
     const SelectivityVector& rows,
     const vector_size_t* rawSizes,
@@ -140,6 +185,13 @@ void CastExpr::applyCastWithTry(
   const auto& queryConfig = context.execCtx()->queryCtx()->config();
   auto isCastIntByTruncate = queryConfig.isCastIntByTruncate();
 
+  if constexpr (
+      CppToType<To>::typeKind == TypeKind::VARCHAR &&
+      std::is_integral_v<From> && !std::is_same_v<From, bool>) {
+    applyIntToVarcharCast<From>(rows, input, resultFlatVector);
+    return;
+  }
+
   if (!nullOnFailure_) {
     if (!isCastIntByTruncate) {
       context.applyToSelectedNoThrow(rows, [&](int row) {
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/expression/ConjunctExpr.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/expression/BooleanMix.h"
 #include "velox/expression/ScopedVarSetter.h"
 
@@ -107,9 +108,9 @@ void ConjunctExpr::evalSpecialForm(
   // Initialize result to all true for AND and all false for OR.
   auto values = flatResult->mutableValues(rows.end())->asMutable<uint64_t>();
   if (isAnd_) {
-    bits::orBits(values, rows.asRange().bits(), rows.begin(), rows.end());
+    simd::orBits(values, rows.asRange().bits(), rows.begin(), rows.end());
   } else {
-    bits::andWithNegatedBits(
+    simd::andWithNegatedBits(
         values, rows.asRange().bits(), rows.begin(), rows.end());
   }
 
@@ -146,10 +147,11 @@ void ConjunctExpr::evalSpecialForm(
     updateResult(inputResult.get(), context, flatResult, activeRows);
     if (extraActive) {
       uint64_t* activeBits = activeRows->asMutableRange().bits();
-      bits::orBits(activeBits, extraActive, rows.begin(), rows.end());
+      simd::orBits(activeBits, extraActive, rows.begin(), rows.end());
       activeRows->updateBounds();
     }
-    numActive = activeRows->countSelected();
+    numActive = simd::countBits(
+        activeRows->asRange().bits(), activeRows->begin(), activeRows->end());
     selectivity_[inputOrder_[i]].addOutput(numActive);
 
     if (!numActive) {
@@ -216,7 +218,7 @@ void ConjunctExpr::updateResult(
         if (result->mayHaveNulls()) {
           activeRows->clearNulls(result->mutableRawNulls());
         }
-        bits::andWithNegatedBits(
+        simd::andWithNegatedBits(
             result->mutableRawValues<uint64_t>(),
             activeRows->asRange().bits(),
             activeRows->begin(),
@@ -227,13 +229,13 @@ void ConjunctExpr::updateResult(
     case BooleanMix::kAllTrue:
       if (!isAnd_) {
         if (result->mayHaveNulls()) {
-          bits::orBits(
+          simd::orBits(
               result->mutableRawNulls(),
               activeRows->asRange().bits(),
               activeRows->begin(),
               activeRows->end());
         }
-        bits::orBits(
+        simd::orBits(
             result->mutableRawValues<uint64_t>(),
             activeRows->asRange().bits(),
             activeRows->begin(),
@@ -996,23 +996,35 @@ void Expr::evalWithMemo(
   VectorPtr base;
   distinctFields_[0]->evalSpecialForm(rows, context, base);
   ++numCachableInput_;
-  if (baseDictionary_ == base) {
+  DictionaryMemo* memo = nullptr;
+  for (size_t i = 0; i < dictionaryMemos_.size(); ++i) {
+    if (dictionaryMemos_[i].base == base) {
+      // Entries are kept in LRU order, most recently used last.
+      std::rotate(
+          dictionaryMemos_.begin() + i,
+          dictionaryMemos_.begin() + i + 1,
+          dictionaryMemos_.end());
+      memo = &dictionaryMemos_.back();
+      break;
+    }
+  }
+  if (memo != nullptr) {
     ++numCacheableRepeats_;
-    if (cachedDictionaryIndices_) {
+    if (memo->rows) {
       LocalSelectivityVector cachedHolder(context, rows);
       auto cached = cachedHolder.get();
       VELOX_DCHECK(cached != nullptr);
-      cached->intersect(*cachedDictionaryIndices_);
+      cached->intersect(*memo->rows);
       if (cached->hasSelections()) {
         context.ensureWritable(rows, type(), result);
-        result->copy(dictionaryCache_.get(), *cached, nullptr);
+        result->copy(memo->values.get(), *cached, nullptr);
       }
     }
     LocalSelectivityVector uncachedHolder(context, rows);
     auto uncached = uncachedHolder.get();
     VELOX_DCHECK(uncached != nullptr);
-    if (cachedDictionaryIndices_) {
-      uncached->deselect(*cachedDictionaryIndices_);
+    if (memo->rows) {
+      uncached->deselect(*memo->rows);
     }
     if (uncached->hasSelections()) {
       // Fix finalSelection at "rows" if uncached rows is a strict subset to
@@ -1026,44 +1038,45 @@ void Expr::evalWithMemo(
       context.exprSet()->addToMemo(this);
       auto newCacheSize = uncached->end();
 
-      // dictionaryCache_ is valid only for cachedDictionaryIndices_. Hence, a
-      // safe call to BaseVector::ensureWritable must include all the rows not
-      // covered by cachedDictionaryIndices_. If BaseVector::ensureWritable is
-      // called only for a subset of rows not covered by
-      // cachedDictionaryIndices_, it will attempt to copy rows that are not
-      // valid leading to a crash.
-      LocalSelectivityVector allUncached(context, dictionaryCache_->size());
+      // 'memo->values' is valid only for 'memo->rows'. Hence, a safe call to
+      // BaseVector::ensureWritable must include all the rows not covered by
+      // 'memo->rows'. If BaseVector::ensureWritable is called only for a
+      // subset of rows not covered by 'memo->rows', it will attempt to copy
+      // rows that are not valid leading to a crash.
+      LocalSelectivityVector allUncached(context, memo->values->size());
       allUncached.get()->setAll();
-      allUncached.get()->deselect(*cachedDictionaryIndices_);
-      context.ensureWritable(*allUncached.get(), type(), dictionaryCache_);
+      allUncached.get()->deselect(*memo->rows);
+      context.ensureWritable(*allUncached.get(), type(), memo->values);
 
-      if (cachedDictionaryIndices_->size() < newCacheSize) {
-        cachedDictionaryIndices_->resize(newCacheSize, false);
+      if (memo->rows->size() < newCacheSize) {
+        memo->rows->resize(newCacheSize, false);
       }
 
-      cachedDictionaryIndices_->select(*uncached);
+      memo->rows->select(*uncached);
 
-      // Resize the dictionaryCache_ to accommodate all the necessary rows.
-      if (dictionaryCache_->size() < uncached->end()) {
-        dictionaryCache_->resize(uncached->end());
+      // Resize 'memo->values' to accommodate all the necessary rows.
+      if (memo->values->size() < uncached->end()) {
+        memo->values->resize(uncached->end());
       }
-      dictionaryCache_->copy(result.get(), *uncached, nullptr);
+      memo->values->copy(result.get(), *uncached, nullptr);
     }
     context.releaseVector(base);
     return;
   }
-  context.releaseVector(baseDictionary_);
-  baseDictionary_ = base;
+  if (dictionaryMemos_.size() >= kMaxMemoizedBases) {
+    auto& oldest = dictionaryMemos_.front();
+    context.releaseVector(oldest.base);
+    context.releaseVector(oldest.values);
+    dictionaryMemos_.erase(dictionaryMemos_.begin());
+  }
+  auto& newMemo = dictionaryMemos_.emplace_back();
+  newMemo.base = base;
   evalWithNulls(rows, context, result);
 
-  context.releaseVector(dictionaryCache_);
-  dictionaryCache_ = result;
-  if (!cachedDictionaryIndices_) {
-    cachedDictionaryIndices_ =
-        context.execCtx()->getSelectivityVector(rows.end());
-  }
-  *cachedDictionaryIndices_ = rows;
-  deselectErrors(context, *cachedDictionaryIndices_);
+  newMemo.values = result;
+  newMemo.rows = context.execCtx()->getSelectivityVector(rows.end());
+  *newMemo.rows = rows;
+  deselectErrors(context, *newMemo.rows);
 }
 
 void Expr::setAllNulls(
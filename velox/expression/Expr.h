@@ -165,9 +165,7 @@ class Expr {
   }
 
   void clearMemo() {
-    baseDictionary_ = nullptr;
-    dictionaryCache_ = nullptr;
-    cachedDictionaryIndices_ = nullptr;
+    dictionaryMemos_.clear();
   }
 
   const TypePtr& type() const {
@@ -411,14 +409,24 @@ class Expr {
   // The rows for which 'sharedSubexprValues_' has a value.
   std::unique_ptr<SelectivityVector> sharedSubexprRows_;
 
-  VectorPtr baseDictionary_;
+  // Results memoized for one dictionary base.
+  struct DictionaryMemo {
+    VectorPtr base;
 
-  // Values computed for the base dictionary, 1:1 to the positions in
-  // 'baseDictionary_'.
-  VectorPtr dictionaryCache_;
+    // Values computed for 'base', 1:1 to its positions.
+    VectorPtr values;
 
-  // The indices that are valid in 'dictionaryCache_'.
-  std::unique_ptr<SelectivityVector> cachedDictionaryIndices_;
+    // The indices that are valid in 'values'.
+    std::unique_ptr<SelectivityVector> rows;
+  };
+
+  // Number of dictionary bases results are memoized for. Workloads
+  // cycling through a handful of shared bases keep them all cached
+  // instead of thrashing a single-entry memo.
+  static constexpr int32_t kMaxMemoizedBases = 4;
+
+  // Memoized results for recently seen dictionary bases, LRU first.
+  std::vector<DictionaryMemo> dictionaryMemos_;
 
   // Count of executions where this is wrapped in a dictionary so that
   // results could be cached.
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <optional>
+
 #include <velox/core/QueryCtx.h>
 #include <velox/expression/Expr.h>
 #include <velox/expression/ExprToSubfieldFilter.h>
@@ -58,6 +60,62 @@ const core::CallTypedExpr* asCall(const core::ITypedExpr* expr) {
   return dynamic_cast<const core::CallTypedExpr*>(expr);
 }
 
+// Returns the subfield designated by input 'index' of 'expr': a plain
+// column reference, or element_at of a map column by a constant key,
+// e.g. features[key1]. nullopt if neither, in which case no subfield
+// filter can be extracted.
+std::optional<common::Subfield> asSubfield(
+    const core::ITypedExpr* expr,
+    int index) {
+  if (auto field = asField(expr, index)) {
+    return common::Subfield(field->name());
+  }
+  auto call = asCall(expr->inputs()[index].get());
+  // Only element_at over a map: it returns null for a missing key, which
+  // matches subfield filter semantics. The strict subscript form errors
+  // on missing keys and array element_at is 1-based, so neither can be
+  // turned into a subfield.
+  if (!call || call->name() != "element_at") {
+    return std::nullopt;
+  }
+  auto* base = dynamic_cast<const core::FieldAccessTypedExpr*>(
+      call->inputs()[0].get());
+  auto* key = dynamic_cast<const core::ConstantTypedExpr*>(
+      call->inputs()[1].get());
+  if (!base || base->type()->kind() != TypeKind::MAP || !key ||
+      key->hasValueVector() || key->value().isNull()) {
+    return std::nullopt;
+  }
+  std::vector<std::unique_ptr<common::Subfield::PathElement>> path;
+  path.push_back(
+      std::make_unique<common::Subfield::NestedField>(base->name()));
+  switch (key->type()->kind()) {
+    case TypeKind::VARCHAR:
+      path.push_back(std::make_unique<common::Subfield::StringSubscript>(
+          key->value().value<TypeKind::VARCHAR>()));
+      break;
+    case TypeKind::TINYINT:
+      path.push_back(std::make_unique<common::Subfield::LongSubscript>(
+          key->value().value<TypeKind::TINYINT>()));
+      break;
+    case TypeKind::SMALLINT:
+      path.push_back(std::make_unique<common::Subfield::LongSubscript>(
+          key->value().value<TypeKind::SMALLINT>()));
+      break;
+    case TypeKind::INTEGER:
+      path.push_back(std::make_unique<common::Subfield::LongSubscript>(
+          key->value().value<TypeKind::INTEGER>()));
+      break;
+    case TypeKind::BIGINT:
+      path.push_back(std::make_unique<common::Subfield::LongSubscript>(
+          key->value().value<TypeKind::BIGINT>()));
+      break;
+    default:
+      return std::nullopt;
+  }
+  return common::Subfield(std::move(path));
+}
+
 common::BigintRange* asBigintRange(std::unique_ptr<common::Filter>& filter) {
   return dynamic_cast<common::BigintRange*>(filter.get());
 }
@@ -374,53 +432,53 @@ std::pair<common::Subfield, std::unique_ptr<common::Filter>> toSubfieldFilter(
           std::move(left.first),
           makeOrFilter(std::move(left.second), std::move(right.second))};
     } else if (call->name() == "eq") {
-      if (auto field = asField(call, 0)) {
-        return {Subfield(field->name()), makeEqualFilter(call->inputs()[1])};
+      if (auto subfield = asSubfield(call, 0)) {
+        return {std::move(*subfield), makeEqualFilter(call->inputs()[1])};
       }
     } else if (call->name() == "neq") {
-      if (auto field = asField(call, 0)) {
-        return {Subfield(field->name()), makeNotEqualFilter(call->inputs()[1])};
+      if (auto subfield = asSubfield(call, 0)) {
+        return {std::move(*subfield), makeNotEqualFilter(call->inputs()[1])};
       }
     } else if (call->name() == "lte") {
-      if (auto field = asField(call, 0)) {
+      if (auto subfield = asSubfield(call, 0)) {
         return {
-            Subfield(field->name()),
+            std::move(*subfield),
             makeLessThanOrEqualFilter(call->inputs()[1])};
       }
     } else if (call->name() == "lt") {
-      if (auto field = asField(call, 0)) {
-        return {Subfield(field->name()), makeLessThanFilter(call->inputs()[1])};
+      if (auto subfield = asSubfield(call, 0)) {
+        return {std::move(*subfield), makeLessThanFilter(call->inputs()[1])};
       }
     } else if (call->name() == "gte") {
-      if (auto field = asField(call, 0)) {
+      if (auto subfield = asSubfield(call, 0)) {
         return {
-            Subfield(field->name()),
+            std::move(*subfield),
             makeGreaterThanOrEqualFilter(call->inputs()[1])};
       }
     } else if (call->name() == "gt") {
-      if (auto field = asField(call, 0)) {
+      if (auto subfield = asSubfield(call, 0)) {
         return {
-            Subfield(field->name()), makeGreaterThanFilter(call->inputs()[1])};
+            std::move(*subfield), makeGreaterThanFilter(call->inputs()[1])};
       }
     } else if (call->name() == "between") {
-      if (auto field = asField(call, 0)) {
+      if (auto subfield = asSubfield(call, 0)) {
         return {
-            Subfield(field->name()),
+            std::move(*subfield),
             makeBetweenFilter(call->inputs()[1], call->inputs()[2])};
       }
     } else if (call->name() == "in") {
-      if (auto field = asField(call, 0)) {
-        return {Subfield(field->name()), makeInFilter(call->inputs()[1])};
+      if (auto subfield = asSubfield(call, 0)) {
+        return {std::move(*subfield), makeInFilter(call->inputs()[1])};
       }
     } else if (call->name() == "is_null") {
-      if (auto field = asField(call, 0)) {
-        return {Subfield(field->name()), isNull()};
+      if (auto subfield = asSubfield(call, 0)) {
+        return {std::move(*subfield), isNull()};
       }
     } else if (call->name() == "not") {
       if (auto nestedCall = asCall(call->inputs()[0].get())) {
         if (nestedCall->name() == "is_null") {
-          if (auto field = asField(nestedCall, 0)) {
-            return {Subfield(field->name()), isNotNull()};
+          if (auto subfield = asSubfield(nestedCall, 0)) {
+            return {std::move(*subfield), isNotNull()};
           }
         }
       }
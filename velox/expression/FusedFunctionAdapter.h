@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+
+#include "velox/expression/DecodedArgs.h"
+#include "velox/expression/VectorFunction.h"
+#include "velox/type/Type.h"
+
+namespace facebook::velox::exec {
+
+/// Fuses a chain of scalar kernels into a single VectorFunction that
+/// evaluates the whole chain in one loop over the input, keeping the
+/// running value in a register instead of materializing a FlatVector
+/// between every step the way a chain of simple functions does.
+///
+/// Each kernel is a stateless struct over primitive type T:
+///
+///   template <typename T>
+///   struct MultiplyKernel {
+///     FOLLY_ALWAYS_INLINE static T apply(T value, T param) {
+///       return value * param;
+///     }
+///   };
+///
+/// FusedKernelFunction<double, MultiplyKernel<double>, PlusKernel<double>>
+/// computes PlusKernel::apply(MultiplyKernel::apply(x, p0), p1) and has
+/// signature (double, double, double) -> double: the input column
+/// followed by one parameter per kernel. Parameters must be constant
+/// over the evaluated rows; the chain is meant for expressions like
+/// plus(multiply(x, 2.0), 1.0) where they are literals.
+template <typename T, typename... TKernels>
+class FusedKernelFunction : public VectorFunction {
+ public:
+  static constexpr size_t kNumKernels = sizeof...(TKernels);
+
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      EvalCtx& context,
+      VectorPtr& result) const override {
+    VELOX_CHECK_EQ(args.size(), 1 + kNumKernels);
+    DecodedArgs decodedArgs(rows, args, context);
+
+    std::array<T, kNumKernels> params;
+    for (auto i = 0; i < kNumKernels; ++i) {
+      auto* param = decodedArgs.at(1 + i);
+      VELOX_USER_CHECK(
+          param->isConstantMapping(),
+          "Parameter {} of a fused kernel chain must be constant",
+          i + 1);
+      params[i] = param->valueAt<T>(rows.begin());
+    }
+
+    context.ensureWritable(rows, outputType, result);
+    auto* flatResult = result->asUnchecked<FlatVector<T>>();
+    flatResult->clearNulls(rows);
+    T* rawResult = flatResult->mutableRawValues();
+
+    auto* input = decodedArgs.at(0);
+    if (input->isIdentityMapping()) {
+      const T* rawInput = input->data<T>();
+      rows.applyToSelected([&](vector_size_t row) {
+        rawResult[row] = applyChain(rawInput[row], params);
+      });
+    } else {
+      rows.applyToSelected([&](vector_size_t row) {
+        rawResult[row] = applyChain(input->valueAt<T>(row), params);
+      });
+    }
+  }
+
+  bool supportsFlatNoNullsFastPath() const override {
+    return true;
+  }
+
+  static std::vector<FunctionSignaturePtr> signatures() {
+    auto type = typeName();
+    FunctionSignatureBuilder builder;
+    builder.returnType(type).argumentType(type);
+    for (size_t i = 0; i < kNumKernels; ++i) {
+      builder.argumentType(type);
+    }
+    return {builder.build()};
+  }
+
+ private:
+  static std::string typeName() {
+    std::string name = CppToType<T>::create()->kindName();
+    for (auto& c : name) {
+      c = std::tolower(c);
+    }
+    return name;
+  }
+
+  FOLLY_ALWAYS_INLINE static T applyChain(
+      T value,
+      const std::array<T, kNumKernels>& params) {
+    return applyChainImpl(
+        value, params, std::make_index_sequence<kNumKernels>{});
+  }
+
+  template <size_t... Is>
+  FOLLY_ALWAYS_INLINE static T applyChainImpl(
+      T value,
+      const std::array<T, kNumKernels>& params,
+      std::index_sequence<Is...>) {
+    ((value = TKernels::apply(value, params[Is])), ...);
+    return value;
+  }
+};
+
+/// Registers 'name' as the fused chain of 'TKernels' over primitive
+/// type T. The function is looked up and evaluated like any other
+/// vector function:
+///
+///   registerFusedKernel<double, MultiplyKernel<double>,
+///       PlusKernel<double>>("fused_multiply_plus");
+///   ... evaluate "fused_multiply_plus(a, 2.0, 1.0)" ...
+template <typename T, typename... TKernels>
+bool registerFusedKernel(const std::string& name) {
+  return registerVectorFunction(
+      name,
+      FusedKernelFunction<T, TKernels...>::signatures(),
+      std::make_unique<FusedKernelFunction<T, TKernels...>>());
+}
+
+} // namespace facebook::velox::exec
@@ -171,6 +171,39 @@ class CastExprTest : public functions::test::CastBaseTest {
   }
 };
 
+TEST_F(CastExprTest, intToString) {
+  // Exercises the bulk integer to varchar kernel, including boundary
+  // values whose negation does not fit the signed type.
+  testCast<int64_t, std::string>(
+      "string",
+      {0,
+       1,
+       -1,
+       12345,
+       -12345,
+       std::numeric_limits<int64_t>::max(),
+       std::numeric_limits<int64_t>::min(),
+       std::nullopt},
+      {"0",
+       "1",
+       "-1",
+       "12345",
+       "-12345",
+       "9223372036854775807",
+       "-9223372036854775808",
+       std::nullopt});
+  testCast<int8_t, std::string>(
+      "string",
+      {127, -128, 0, std::nullopt},
+      {"127", "-128", "0", std::nullopt});
+  testCast<int16_t, std::string>(
+      "string", {32767, -32768}, {"32767", "-32768"});
+  testCast<int32_t, std::string>(
+      "string",
+      {2147483647, -2147483648},
+      {"2147483647", "-2147483648"});
+}
+
 TEST_F(CastExprTest, basics) {
   // Testing non-null or error cases
   const std::vector<std::optional<int32_t>> ii = {1, 2, 3, 100, -100};
@@ -430,3 +430,37 @@ TEST_F(ExprStatsTest, errorLog) {
 
   ASSERT_TRUE(exec::unregisterExprSetListener(listener));
 }
+
+TEST_F(ExprStatsTest, sharedSubexpressionAcrossProjections) {
+  vector_size_t size = 1'024;
+  auto data = makeRowVector({
+      makeFlatVector<double>(size, [](auto row) { return row * 1.1; }),
+      makeFlatVector<double>(size, [](auto row) { return row * 2.2; }),
+  });
+  auto rowType = asRowType(data->type());
+
+  auto exprSet = compileExpressions(
+      {"floor(c0 + c1)", "ceil(c0 + c1)", "(c0 + c1) * 0.5"}, rowType);
+
+  // The plus is compiled once and shared by all three projections.
+  auto* shared = exprSet->exprs()[0]->inputs()[0].get();
+  ASSERT_EQ(shared, exprSet->exprs()[1]->inputs()[0].get());
+  ASSERT_EQ(shared, exprSet->exprs()[2]->inputs()[0].get());
+
+  exec::EvalCtx context(&execCtx_, exprSet.get(), data.get());
+
+  // Evaluate the first half of the rows, then all rows without
+  // re-initializing, the way a filter and its projections share one batch.
+  // The shared plus computes each row exactly once: the first half on the
+  // first call and only the newly active half on the second.
+  SelectivityVector firstHalf(size);
+  firstHalf.setValidRange(size / 2, size, false);
+  firstHalf.updateBounds();
+  std::vector<VectorPtr> results(3);
+  exprSet->eval(0, 3, true, firstHalf, context, results);
+  EXPECT_EQ(size / 2, shared->stats().numProcessedRows);
+
+  SelectivityVector allRows(size);
+  exprSet->eval(0, 3, false, allRows, context, results);
+  EXPECT_EQ(size, shared->stats().numProcessedRows);
+}
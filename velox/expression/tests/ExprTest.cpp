@@ -1847,6 +1847,61 @@ TEST_F(ExprTest, memo) {
   assertEqualVectors(expectedResult, result);
 }
 
+// Verifies that dictionary-over-dictionary input is peeled with the index
+// levels composed into one translation, so the expression is evaluated on
+// the innermost base and the result is rewrapped rather than flattened.
+TEST_F(ExprTest, peelNestedDictionary) {
+  constexpr vector_size_t kBaseSize = 10;
+  constexpr vector_size_t kSize = 1'000;
+  auto base =
+      makeFlatVector<int64_t>(kBaseSize, [](auto row) { return row; });
+  auto innerIndices = makeIndices(kSize, [](auto row) { return row % 10; });
+  auto outerIndices =
+      makeIndices(kSize, [](auto row) { return (row * 7) % kSize; });
+  auto vector = wrapInDictionary(
+      outerIndices, kSize, wrapInDictionary(innerIndices, kSize, base));
+
+  auto result = evaluate("c0 + 1", makeRowVector({vector}));
+
+  ASSERT_EQ(VectorEncoding::Simple::DICTIONARY, result->encoding());
+  EXPECT_LE(result->valueVector()->size(), kBaseSize);
+
+  auto expected = makeFlatVector<int64_t>(
+      kSize, [](auto row) { return (row * 7) % kSize % 10 + 1; });
+  assertEqualVectors(expected, result);
+}
+
+// Verifies that results stay correct when evaluation cycles through several
+// dictionary bases, each with its own memo entry.
+TEST_F(ExprTest, memoMultipleBases) {
+  std::vector<VectorPtr> bases;
+  for (auto i = 0; i < 3; ++i) {
+    bases.push_back(makeArrayVector<int64_t>(
+        1'000,
+        [](auto row) { return row % 5 + 1; },
+        [i](auto row, auto index) { return (row % 3) + index + i; }));
+  }
+
+  auto rowType = ROW({"c0"}, {bases[0]->type()});
+  auto exprSet = compileExpression("c0[1] = 1", rowType);
+
+  // Interleave slices of the bases. Each evaluation after the first one
+  // over a base hits that base's memo entry.
+  for (auto round = 0; round < 3; ++round) {
+    for (auto i = 0; i < 3; ++i) {
+      auto indices =
+          makeIndices(100, [&](auto row) { return 8 + round + row * 2; });
+      auto result = evaluate(
+          exprSet.get(),
+          makeRowVector({wrapInDictionary(indices, 100, bases[i])}));
+      auto expectedResult = makeFlatVector<bool>(100, [&](auto row) {
+        return (8 + round + row * 2) % 3 + i == 1;
+      });
+      assertEqualVectors(expectedResult, result);
+    }
+  }
+}
+
 // This test triggers the situation when peelEncodings() produces an empty
 // selectivity vector, which if passed to evalWithMemo() causes the latter to
 // produce null Expr::dictionaryCache_, which leads to a crash in evaluation
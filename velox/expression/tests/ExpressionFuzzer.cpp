@@ -21,6 +21,7 @@
 
 #include "velox/buffer/Buffer.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/time/Timer.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/FunctionSignature.h"
 #include "velox/expression/SignatureBinder.h"
@@ -35,6 +36,14 @@
 
 DEFINE_int32(steps, 10, "Number of expressions to generate and execute.");
 
+DEFINE_int32(
+    perf_differential_iterations,
+    0,
+    "When positive, each correct expression is also timed for this many "
+    "repeated evaluations under the common and the simplified paths, and "
+    "expressions where the optimized common path comes out slower than the "
+    "reference are logged as potential vectorized-path regressions.");
+
 DEFINE_int32(
     duration_sec,
     0,
@@ -638,6 +647,49 @@ void ExpressionFuzzer::persistReproInfo(
 //  - true if both succeeded and returned the exact same results.
 //  - false if both failed with compatible exceptions.
 //  - throws otherwise (incompatible exceptions or different results).
+void ExpressionFuzzer::measurePerfDifferential(
+    const core::TypedExprPtr& plan,
+    const RowVectorPtr& rowVector,
+    const SelectivityVector& rows) {
+  const int32_t iterations = FLAGS_perf_differential_iterations;
+  uint64_t commonMicros = 0;
+  uint64_t simplifiedMicros = 0;
+  try {
+    {
+      exec::ExprSet exprSet(
+          {plan}, &execCtx_, !FLAGS_disable_constant_folding);
+      exec::EvalCtx evalCtx(&execCtx_, &exprSet, rowVector.get());
+      std::vector<VectorPtr> result(1);
+      const auto start = getCurrentTimeMicro();
+      for (auto i = 0; i < iterations; ++i) {
+        exprSet.eval(rows, evalCtx, result);
+      }
+      commonMicros = getCurrentTimeMicro() - start;
+    }
+    {
+      exec::ExprSetSimplified exprSet({plan}, &execCtx_);
+      exec::EvalCtx evalCtx(&execCtx_, &exprSet, rowVector.get());
+      std::vector<VectorPtr> result(1);
+      const auto start = getCurrentTimeMicro();
+      for (auto i = 0; i < iterations; ++i) {
+        exprSet.eval(rows, evalCtx, result);
+      }
+      simplifiedMicros = getCurrentTimeMicro() - start;
+    }
+  } catch (...) {
+    // Correctness already passed; skip timing for throwing repeats.
+    return;
+  }
+  // The simplified path is the unoptimized reference: the common path
+  // losing to it beyond noise means a vectorized-path regression.
+  if (commonMicros > simplifiedMicros + simplifiedMicros / 10) {
+    LOG(WARNING) << "PERF: common path slower than simplified reference ("
+                 << commonMicros << "us vs " << simplifiedMicros
+                 << "us over " << iterations
+                 << " iterations) for: " << plan->toString();
+  }
+}
+
 bool ExpressionFuzzer::executeExpression(
     const core::TypedExprPtr& plan,
     const RowVectorPtr& rowVector,
@@ -734,6 +786,9 @@ bool ExpressionFuzzer::executeExpression(
     } else {
       // Throws in case output is different.
       compareVectors(commonEvalResult.front(), simplifiedEvalResult.front());
+      if (FLAGS_perf_differential_iterations > 0) {
+        measurePerfDifferential(plan, rowVector, rows);
+      }
     }
   } catch (...) {
     if (!FLAGS_repro_persist_path.empty()) {
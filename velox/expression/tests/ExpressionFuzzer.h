@@ -105,6 +105,15 @@ class ExpressionFuzzer {
   //  - true if both succeeded and returned the exact same results.
   //  - false if both failed with compatible exceptions.
   //  - throws otherwise (incompatible exceptions or different results).
+  // Times repeated evaluation of 'plan' under the common and the
+  // simplified paths and logs expressions where the optimized common
+  // path is slower than the reference: those point at vectorized-path
+  // regressions such as broken dictionary peeling.
+  void measurePerfDifferential(
+      const core::TypedExprPtr& plan,
+      const RowVectorPtr& rowVector,
+      const SelectivityVector& rows);
+
   bool executeExpression(
       const core::TypedExprPtr& plan,
       const RowVectorPtr& rowVector,
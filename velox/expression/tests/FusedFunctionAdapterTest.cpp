@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/expression/FusedFunctionAdapter.h"
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/functions/prestosql/tests/utils/FunctionBaseTest.h"
+
+namespace {
+
+using namespace facebook::velox;
+using namespace facebook::velox::test;
+
+template <typename T>
+struct MultiplyKernel {
+  FOLLY_ALWAYS_INLINE static T apply(T value, T param) {
+    return value * param;
+  }
+};
+
+template <typename T>
+struct PlusKernel {
+  FOLLY_ALWAYS_INLINE static T apply(T value, T param) {
+    return value + param;
+  }
+};
+
+class FusedFunctionAdapterTest : public functions::test::FunctionBaseTest {
+ protected:
+  static void SetUpTestCase() {
+    FunctionBaseTest::SetUpTestCase();
+    exec::registerFusedKernel<
+        double,
+        MultiplyKernel<double>,
+        PlusKernel<double>>("fused_multiply_plus");
+    exec::registerFusedKernel<int64_t, PlusKernel<int64_t>>("fused_plus");
+  }
+};
+
+TEST_F(FusedFunctionAdapterTest, basic) {
+  auto input = makeFlatVector<double>(
+      1'000, [](auto row) { return row * 0.5; }, nullEvery(7));
+  auto result = evaluate<FlatVector<double>>(
+      "fused_multiply_plus(c0, 2.0, 1.0)", makeRowVector({input}));
+
+  for (auto i = 0; i < input->size(); ++i) {
+    if (i % 7 == 0) {
+      EXPECT_TRUE(result->isNullAt(i)) << "at " << i;
+    } else {
+      EXPECT_DOUBLE_EQ(i * 0.5 * 2.0 + 1.0, result->valueAt(i)) << "at " << i;
+    }
+  }
+}
+
+TEST_F(FusedFunctionAdapterTest, singleKernel) {
+  auto input =
+      makeFlatVector<int64_t>(100, [](auto row) { return row * 10; });
+  auto result = evaluate<SimpleVector<int64_t>>(
+      "fused_plus(c0, 5)", makeRowVector({input}));
+
+  for (auto i = 0; i < input->size(); ++i) {
+    EXPECT_EQ(i * 10 + 5, result->valueAt(i)) << "at " << i;
+  }
+}
+
+TEST_F(FusedFunctionAdapterTest, dictionaryInput) {
+  auto base = makeFlatVector<double>(10, [](auto row) { return row * 1.0; });
+  auto indices = makeIndices(100, [](auto row) { return row % 10; });
+  auto input = wrapInDictionary(indices, 100, base);
+
+  auto result = evaluate<SimpleVector<double>>(
+      "fused_multiply_plus(c0, 3.0, 2.0)", makeRowVector({input}));
+
+  for (auto i = 0; i < 100; ++i) {
+    EXPECT_DOUBLE_EQ((i % 10) * 3.0 + 2.0, result->valueAt(i)) << "at " << i;
+  }
+}
+
+TEST_F(FusedFunctionAdapterTest, nonConstantParam) {
+  auto input = makeFlatVector<double>(10, [](auto row) { return row * 1.0; });
+  VELOX_ASSERT_THROW(
+      evaluate<SimpleVector<double>>(
+          "fused_multiply_plus(c0, c0, 1.0)", makeRowVector({input})),
+      "Parameter 1 of a fused kernel chain must be constant");
+}
+
+} // namespace
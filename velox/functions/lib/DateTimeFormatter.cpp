@@ -897,6 +897,55 @@ void parseFromPattern(
 
 } // namespace
 
+namespace {
+
+// Digit pairs "00".."99" for branch-free two-digit formatting.
+struct DigitPairs {
+  char data[200]{};
+  constexpr DigitPairs() {
+    for (int i = 0; i < 100; ++i) {
+      data[2 * i] = '0' + i / 10;
+      data[2 * i + 1] = '0' + i % 10;
+    }
+  }
+};
+constexpr DigitPairs kDigitPairs;
+
+inline void writeTwoDigits(char* out, int32_t value) {
+  std::memcpy(out, &kDigitPairs.data[2 * value], 2);
+}
+
+} // namespace
+
+void DateTimeFormatter::detectFastPattern() {
+  using S = DateTimeFormatSpecifier;
+  auto pattern = [](S specifier, size_t digits) {
+    return DateTimeToken(FormatPattern{specifier, digits});
+  };
+  auto literal = [](std::string_view text) { return DateTimeToken(text); };
+
+  const std::vector<DateTimeToken> date = {
+      pattern(S::YEAR_OF_ERA, 4),
+      literal("-"),
+      pattern(S::MONTH_OF_YEAR, 2),
+      literal("-"),
+      pattern(S::DAY_OF_MONTH, 2)};
+  if (tokens_ == date) {
+    fastPattern_ = FastPattern::kDate;
+    return;
+  }
+  std::vector<DateTimeToken> dateTime = date;
+  dateTime.push_back(literal(" "));
+  dateTime.push_back(pattern(S::HOUR_OF_DAY, 2));
+  dateTime.push_back(literal(":"));
+  dateTime.push_back(pattern(S::MINUTE_OF_HOUR, 2));
+  dateTime.push_back(literal(":"));
+  dateTime.push_back(pattern(S::SECOND_OF_MINUTE, 2));
+  if (tokens_ == dateTime) {
+    fastPattern_ = FastPattern::kDateTime;
+  }
+}
+
 std::string DateTimeFormatter::format(
     const Timestamp& timestamp,
     const date::time_zone* timezone) const {
@@ -910,6 +959,30 @@ std::string DateTimeFormatter::format(
   const date::year_month_day calDate(daysTimePoint);
   const date::weekday weekday(daysTimePoint);
 
+  if (fastPattern_ != FastPattern::kNone) {
+    const auto year = static_cast<int32_t>(static_cast<signed>(calDate.year()));
+    // Negative and five-digit years take the generic era handling.
+    if (year >= 1 && year <= 9999) {
+      char buffer[19];
+      writeTwoDigits(buffer, year / 100);
+      writeTwoDigits(buffer + 2, year % 100);
+      buffer[4] = '-';
+      writeTwoDigits(buffer + 5, static_cast<unsigned>(calDate.month()));
+      buffer[7] = '-';
+      writeTwoDigits(buffer + 8, static_cast<unsigned>(calDate.day()));
+      if (fastPattern_ == FastPattern::kDate) {
+        return std::string(buffer, 10);
+      }
+      buffer[10] = ' ';
+      writeTwoDigits(buffer + 11, durationInTheDay.hours().count());
+      buffer[13] = ':';
+      writeTwoDigits(buffer + 14, durationInTheDay.minutes().count());
+      buffer[16] = ':';
+      writeTwoDigits(buffer + 17, durationInTheDay.seconds().count());
+      return std::string(buffer, 19);
+    }
+  }
+
   std::string result;
   for (auto& token : tokens_) {
     if (token.type == DateTimeToken::Type::kLiteral) {
@@ -159,7 +159,9 @@ class DateTimeFormatter {
       : literalBuf_(std::move(literalBuf)),
         bufSize_(bufSize),
         tokens_(std::move(tokens)),
-        type_(type) {}
+        type_(type) {
+    detectFastPattern();
+  }
 
   const std::unique_ptr<char[]>& literalBuf() const {
     return literalBuf_;
@@ -180,10 +182,18 @@ class DateTimeFormatter {
       const date::time_zone* timezone) const;
 
  private:
+  // Canonical patterns formatted through a two-digit lookup table
+  // instead of the per-token loop: %Y-%m-%d and %Y-%m-%d %H:%i:%s.
+  enum class FastPattern { kNone, kDate, kDateTime };
+
+  // Recognizes the token sequences of the fast patterns.
+  void detectFastPattern();
+
   std::unique_ptr<char[]> literalBuf_;
   size_t bufSize_;
   std::vector<DateTimeToken> tokens_;
   DateTimeFormatterType type_;
+  FastPattern fastPattern_{FastPattern::kNone};
 };
 
 std::shared_ptr<DateTimeFormatter> buildMysqlDateTimeFormatter(
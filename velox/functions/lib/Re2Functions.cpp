@@ -18,6 +18,7 @@
 #include <re2/re2.h>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "velox/expression/EvalCtx.h"
 #include "velox/expression/Expr.h"
@@ -392,6 +393,18 @@ bool matchPrefixPattern(
       std::memcmp(input.data(), pattern.data(), length) == 0;
 }
 
+// Match string 'input' if it contains the fixed part of a substring
+// pattern (%fixed%). string_view::find probes for the first needle
+// byte with memchr and confirms with memcmp, both vectorized in libc.
+bool matchSubstringPattern(
+    StringView input,
+    const char* fixedPattern,
+    vector_size_t length) {
+  return std::string_view(input.data(), input.size())
+             .find(std::string_view(fixedPattern, length)) !=
+      std::string_view::npos;
+}
+
 // Match the last 'length' characters of string 'input' and suffix pattern.
 bool matchSuffixPattern(
     StringView input,
@@ -410,7 +423,15 @@ class OptimizedLikeWithMemcmp final : public VectorFunction {
   OptimizedLikeWithMemcmp(
       StringView pattern,
       vector_size_t reducedPatternLength)
-      : pattern_{pattern}, reducedPatternLength_{reducedPatternLength} {}
+      : pattern_{pattern}, reducedPatternLength_{reducedPatternLength} {
+    if constexpr (P == PatternKind::kSubstring) {
+      // Skip the leading '%'s to the fixed part of the pattern.
+      while (fixedPatternStart_ < pattern_.size() &&
+             pattern_.data()[fixedPatternStart_] == '%') {
+        ++fixedPatternStart_;
+      }
+    }
+  }
 
   bool match(StringView input) const {
     switch (P) {
@@ -424,6 +445,11 @@ class OptimizedLikeWithMemcmp final : public VectorFunction {
         return matchPrefixPattern(input, pattern_, reducedPatternLength_);
       case PatternKind::kSuffix:
         return matchSuffixPattern(input, pattern_, reducedPatternLength_);
+      case PatternKind::kSubstring:
+        return matchSubstringPattern(
+            input,
+            pattern_.data() + fixedPatternStart_,
+            reducedPatternLength_);
     }
   }
 
@@ -461,6 +487,9 @@ class OptimizedLikeWithMemcmp final : public VectorFunction {
  private:
   StringView pattern_;
   vector_size_t reducedPatternLength_;
+
+  // Offset of the fixed part within a substring pattern.
+  vector_size_t fixedPatternStart_{0};
 };
 
 class LikeWithRe2 final : public VectorFunction {
@@ -822,12 +851,23 @@ std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern) {
   vector_size_t singleCharacterWildcardCount = 0;
   auto patternStr = pattern.data();
 
+  // Index of a second wildcard stream, which is only allowed as a
+  // trailing run of '%' making the pattern a substring match.
+  vector_size_t secondWildcardStart = -1;
+
   while (i < patternLength) {
     if (patternStr[i] == '%' || patternStr[i] == '_') {
-      // Ensures that pattern has a single contiguous stream of wildcard
-      // characters.
+      // A second stream of wildcard characters qualifies only when it
+      // is all '%' and runs to the end of the pattern (%fixed%).
       if (wildcardStart != -1) {
-        return std::make_pair(PatternKind::kGeneric, 0);
+        secondWildcardStart = i;
+        while (i < patternLength && patternStr[i] == '%') {
+          i++;
+        }
+        if (i != patternLength) {
+          return std::make_pair(PatternKind::kGeneric, 0);
+        }
+        break;
       }
       // Look till the last contiguous wildcard character, starting from this
       // index, is found, or the end of pattern is reached.
@@ -868,6 +908,11 @@ std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern) {
   if (singleCharacterWildcardCount) {
     return {PatternKind::kGeneric, 0};
   }
+  // '%' runs on both sides of one fixed pattern: substring match.
+  if (secondWildcardStart != -1) {
+    VELOX_DCHECK_LT(wildcardStart, fixedPatternStart);
+    return {PatternKind::kSubstring, secondWildcardStart - fixedPatternStart};
+  }
   // Classify pattern as prefix pattern or suffix pattern based on the
   // positions of the fixed pattern and contiguous wildcard character stream.
   if (fixedPatternStart < wildcardStart) {
@@ -950,6 +995,10 @@ std::shared_ptr<exec::VectorFunction> makeLike(
       case PatternKind::kSuffix:
         return std::make_shared<OptimizedLikeWithMemcmp<PatternKind::kSuffix>>(
             pattern, reducedLength);
+      case PatternKind::kSubstring:
+        return std::make_shared<
+            OptimizedLikeWithMemcmp<PatternKind::kSubstring>>(
+            pattern, reducedLength);
       default:
         return std::make_shared<LikeWithRe2>(pattern, escapeChar);
     }
@@ -47,7 +47,28 @@ namespace stringCore {
 static bool isAscii(const char* str, size_t length);
 
 FOLLY_ALWAYS_INLINE bool isAscii(const char* str, size_t length) {
-  for (auto i = 0; i < length; i++) {
+  // OR together 32 bytes per iteration and test the high bits once: a
+  // branchless accumulation the compiler maps onto vector registers,
+  // so the scan runs at memory bandwidth instead of a byte at a time.
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    uint64_t words[4];
+    std::memcpy(words, str + i, 32);
+    if (((words[0] | words[1] | words[2] | words[3]) & kHighBits) != 0) {
+      return false;
+    }
+  }
+  uint64_t accumulated = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, str + i, 8);
+    accumulated |= word;
+  }
+  if ((accumulated & kHighBits) != 0) {
+    return false;
+  }
+  for (; i < length; ++i) {
     if (str[i] & 0x80) {
       return false;
     }
@@ -438,6 +438,31 @@ TEST_F(Re2FunctionsTest, likeDeterminePatternKind) {
   testPattern("%%_%aBcD", PatternKind::kGeneric, 0);
   testPattern("%%a%%BcD", PatternKind::kGeneric, 0);
   testPattern("foo%bar", PatternKind::kGeneric, 0);
+
+  testPattern("%presto%", PatternKind::kSubstring, 6);
+  testPattern("%%hello%%%", PatternKind::kSubstring, 5);
+  testPattern("%a%", PatternKind::kSubstring, 1);
+  testPattern("%_presto%", PatternKind::kGeneric, 0);
+  testPattern("%presto_%", PatternKind::kGeneric, 0);
+  testPattern("%pre%sto%", PatternKind::kGeneric, 0);
+}
+
+TEST_F(Re2FunctionsTest, likeSubstringPattern) {
+  auto like = [&](std::string str, std::string pattern) {
+    auto likeResult = evaluateOnce<bool>(
+        fmt::format("like(c0, '{}')", pattern), std::make_optional(str));
+    VELOX_CHECK(likeResult, "Like operator evaluation failed");
+    return *likeResult;
+  };
+
+  EXPECT_TRUE(like("hello presto world", "%presto%"));
+  EXPECT_TRUE(like("presto", "%presto%"));
+  EXPECT_TRUE(like("prestopresto", "%%presto%%"));
+  EXPECT_FALSE(like("hello velox world", "%presto%"));
+  EXPECT_FALSE(like("prest", "%presto%"));
+  EXPECT_FALSE(like("", "%presto%"));
+  EXPECT_TRUE(like("abc", "%b%"));
+  EXPECT_FALSE(like("abc", "%d%"));
 }
 
 TEST_F(Re2FunctionsTest, likePatternWildcard) {
@@ -623,6 +623,35 @@ struct DateTruncFunction : public TimestampWithTimezoneSupport<T> {
       return;
     }
 
+    // Without a session time zone, boundaries of sub-day units are fixed
+    // offsets of the epoch, so truncation is integer arithmetic with no
+    // calendar round trip. The double mod keeps flooring correct for
+    // pre-epoch timestamps.
+    if (timeZone_ == nullptr) {
+      int64_t secondsInUnit = 0;
+      switch (unit) {
+        case DateTimeUnit::kMinute:
+          secondsInUnit = 60;
+          break;
+        case DateTimeUnit::kHour:
+          secondsInUnit = 3'600;
+          break;
+        case DateTimeUnit::kDay:
+          secondsInUnit = 86'400;
+          break;
+        default:
+          break;
+      }
+      if (secondsInUnit != 0) {
+        const auto seconds = timestamp.getSeconds();
+        result = Timestamp(
+            seconds -
+                ((seconds % secondsInUnit + secondsInUnit) % secondsInUnit),
+            0);
+        return;
+      }
+    }
+
     auto dateTime = getDateTime(timestamp, timeZone_);
     adjustDateTime(dateTime, unit);
 
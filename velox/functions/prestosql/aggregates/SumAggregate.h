@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <limits>
+
 #include "velox/expression/FunctionSignature.h"
 #include "velox/functions/prestosql/CheckedArithmeticImpl.h"
 #include "velox/functions/prestosql/aggregates/SimpleNumericAggregate.h"
@@ -84,6 +86,13 @@ class SumAggregate
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if constexpr (
+        std::is_integral_v<TInput> && std::is_integral_v<TAccumulator> &&
+        !std::is_same_v<TInput, bool>) {
+      if (trySumNoOverflowCheck(group, rows, args[0])) {
+        return;
+      }
+    }
     BaseAggregate::template updateOneGroup<TAccumulator>(
         group,
         rows,
@@ -94,6 +103,51 @@ class SumAggregate
         TAccumulator(0));
   }
 
+  /// Sums all selected rows of a flat, null-free integer 'arg' into
+  /// 'group' without a per-row overflow branch: one branchless pass
+  /// accumulates the batch sum and the value bounds, and the stored
+  /// result is committed only when the bounds prove that no prefix of
+  /// the addition sequence can leave the accumulator range, which is
+  /// exactly when the per-row checked path cannot throw. Returns false
+  /// to take the checked per-row path.
+  bool trySumNoOverflowCheck(
+      char* group,
+      const SelectivityVector& rows,
+      const VectorPtr& arg) {
+    if (arg->encoding() != VectorEncoding::Simple::FLAT ||
+        arg->mayHaveNulls()) {
+      return false;
+    }
+    if (!rows.hasSelections()) {
+      return true;
+    }
+    const TInput* data = arg->asUnchecked<FlatVector<TInput>>()->rawValues();
+    int128_t sum = 0;
+    TInput minValue = std::numeric_limits<TInput>::max();
+    TInput maxValue = std::numeric_limits<TInput>::min();
+    rows.applyToSelected([&](vector_size_t i) {
+      const TInput value = data[i];
+      sum += value;
+      minValue = std::min(minValue, value);
+      maxValue = std::max(maxValue, value);
+    });
+    const int128_t count = rows.countSelected();
+    const int128_t accumulator =
+        *exec::Aggregate::value<TAccumulator>(group);
+    const int128_t lowestPrefix =
+        accumulator + std::min<int128_t>(0, count * minValue);
+    const int128_t highestPrefix =
+        accumulator + std::max<int128_t>(0, count * maxValue);
+    if (lowestPrefix < std::numeric_limits<TAccumulator>::min() ||
+        highestPrefix > std::numeric_limits<TAccumulator>::max()) {
+      return false;
+    }
+    exec::Aggregate::clearNull(group);
+    *exec::Aggregate::value<TAccumulator>(group) =
+        static_cast<TAccumulator>(accumulator + sum);
+    return true;
+  }
+
   void addSingleGroupIntermediateResults(
       char* group,
       const SelectivityVector& rows,
@@ -16,7 +16,9 @@
 
 #include "velox/functions/prestosql/json/JsonExtractor.h"
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <unordered_map>
 #include <vector>
 
@@ -171,6 +173,343 @@ bool isScalarType(const folly::Optional<folly::dynamic>& json) {
       !json->isNull();
 }
 
+// A zero-allocation scanner for jsonExtractScalar with simple paths
+// ($.key.key2[3]...). It walks the document text directly, skipping the
+// values off the addressed path byte-wise instead of building a
+// folly::dynamic tree for the whole document. It is strict: anything it
+// cannot prove well formed, and any result whose text would need
+// normalization (escaped strings, non-integer numbers), falls back to
+// the full parser.
+namespace fastjson {
+
+// A path token applies as an object key or, when all digits, as an
+// array index, decided by the type of the node it lands on, like the
+// full extractor.
+struct PathToken {
+  folly::StringPiece key;
+  int64_t index{-1};
+};
+
+// Parses paths of the form $(.key|[index])*. Returns false for any
+// other syntax, e.g. quoted keys, wildcards or '..'.
+bool parseSimplePath(folly::StringPiece path, std::vector<PathToken>& tokens) {
+  auto trimmed = folly::trimWhitespace(path);
+  if (trimmed.empty() || trimmed[0] != '$') {
+    return false;
+  }
+  size_t i = 1;
+  while (i < trimmed.size()) {
+    if (trimmed[i] == '.') {
+      ++i;
+      const size_t start = i;
+      while (i < trimmed.size() &&
+             (isalnum(static_cast<unsigned char>(trimmed[i])) ||
+              trimmed[i] == '_')) {
+        ++i;
+      }
+      if (i == start) {
+        return false;
+      }
+      PathToken token{trimmed.subpiece(start, i - start), -1};
+      if (token.key.size() <= 18 &&
+          std::all_of(token.key.begin(), token.key.end(), [](char c) {
+            return isdigit(static_cast<unsigned char>(c));
+          })) {
+        token.index = 0;
+        for (auto c : token.key) {
+          token.index = token.index * 10 + (c - '0');
+        }
+      }
+      tokens.push_back(token);
+    } else if (trimmed[i] == '[') {
+      ++i;
+      const size_t start = i;
+      while (i < trimmed.size() &&
+             isdigit(static_cast<unsigned char>(trimmed[i]))) {
+        ++i;
+      }
+      if (i == start || i - start > 18 || i >= trimmed.size() ||
+          trimmed[i] != ']') {
+        return false;
+      }
+      int64_t index = 0;
+      for (auto j = start; j < i; ++j) {
+        index = index * 10 + (trimmed[j] - '0');
+      }
+      tokens.push_back(PathToken{trimmed.subpiece(start, i - start), index});
+      ++i;
+    } else {
+      return false;
+    }
+  }
+  return !tokens.empty();
+}
+
+const char* skipWhitespace(const char* pos, const char* end) {
+  while (pos < end &&
+         (*pos == ' ' || *pos == '\t' || *pos == '\n' || *pos == '\r')) {
+    ++pos;
+  }
+  return pos;
+}
+
+// 'pos' is at the opening quote. Returns the position after the closing
+// quote, nullptr if malformed.
+const char* skipString(const char* pos, const char* end) {
+  ++pos;
+  while (pos < end) {
+    if (*pos == '\\') {
+      pos += 2;
+    } else if (*pos == '"') {
+      return pos + 1;
+    } else {
+      ++pos;
+    }
+  }
+  return nullptr;
+}
+
+// 'pos' is at the first character of a literal or number. Validates it
+// and returns the position after it, nullptr if invalid.
+const char* skipLiteral(const char* pos, const char* end) {
+  auto match = [&](folly::StringPiece text) -> const char* {
+    if (end - pos >= static_cast<int64_t>(text.size()) &&
+        std::memcmp(pos, text.data(), text.size()) == 0) {
+      return pos + text.size();
+    }
+    return nullptr;
+  };
+  if (*pos == 't') {
+    return match("true");
+  }
+  if (*pos == 'f') {
+    return match("false");
+  }
+  if (*pos == 'n') {
+    return match("null");
+  }
+  // Number: -?digits(.digits)?([eE][+-]?digits)?
+  if (*pos == '-') {
+    ++pos;
+  }
+  const char* digitsStart = pos;
+  while (pos < end && isdigit(static_cast<unsigned char>(*pos))) {
+    ++pos;
+  }
+  if (pos == digitsStart) {
+    return nullptr;
+  }
+  if (*digitsStart == '0' && pos - digitsStart > 1) {
+    // JSON rejects leading zeros in the integer part.
+    return nullptr;
+  }
+  if (pos < end && *pos == '.') {
+    ++pos;
+    digitsStart = pos;
+    while (pos < end && isdigit(static_cast<unsigned char>(*pos))) {
+      ++pos;
+    }
+    if (pos == digitsStart) {
+      return nullptr;
+    }
+  }
+  if (pos < end && (*pos == 'e' || *pos == 'E')) {
+    ++pos;
+    if (pos < end && (*pos == '+' || *pos == '-')) {
+      ++pos;
+    }
+    digitsStart = pos;
+    while (pos < end && isdigit(static_cast<unsigned char>(*pos))) {
+      ++pos;
+    }
+    if (pos == digitsStart) {
+      return nullptr;
+    }
+  }
+  return pos;
+}
+
+const char* skipValue(const char* pos, const char* end);
+
+// 'pos' is after the opening brace/bracket. Skips the members and
+// returns the position after the matching closer, nullptr if malformed.
+const char* skipContainer(const char* pos, const char* end, char closer) {
+  pos = skipWhitespace(pos, end);
+  if (pos < end && *pos == closer) {
+    return pos + 1;
+  }
+  while (pos < end) {
+    if (closer == '}') {
+      if (*pos != '"') {
+        return nullptr;
+      }
+      pos = skipString(pos, end);
+      if (pos == nullptr) {
+        return nullptr;
+      }
+      pos = skipWhitespace(pos, end);
+      if (pos >= end || *pos != ':') {
+        return nullptr;
+      }
+      pos = skipWhitespace(pos + 1, end);
+    }
+    pos = skipValue(pos, end);
+    if (pos == nullptr) {
+      return nullptr;
+    }
+    pos = skipWhitespace(pos, end);
+    if (pos >= end) {
+      return nullptr;
+    }
+    if (*pos == closer) {
+      return pos + 1;
+    }
+    if (*pos != ',') {
+      return nullptr;
+    }
+    pos = skipWhitespace(pos + 1, end);
+  }
+  return nullptr;
+}
+
+const char* skipValue(const char* pos, const char* end) {
+  if (pos >= end) {
+    return nullptr;
+  }
+  switch (*pos) {
+    case '"':
+      return skipString(pos, end);
+    case '{':
+      return skipContainer(pos + 1, end, '}');
+    case '[':
+      return skipContainer(pos + 1, end, ']');
+    default:
+      return skipLiteral(pos, end);
+  }
+}
+
+enum class ScanState { kFound, kNotFound, kFallback };
+
+// Navigates 'json' along 'tokens'. On kFound, 'value' is the text of
+// the addressed value. Objects are scanned to their end so that
+// duplicate keys resolve to the last one, matching the full parser.
+ScanState scanPath(
+    folly::StringPiece json,
+    const std::vector<PathToken>& tokens,
+    folly::StringPiece& value) {
+  const char* pos = json.begin();
+  const char* end = json.end();
+  const char* valueBegin = skipWhitespace(pos, end);
+  const char* valueEnd = skipValue(valueBegin, end);
+  if (valueEnd == nullptr ||
+      skipWhitespace(valueEnd, end) != end) {
+    // Malformed document: the full parser decides (it returns none).
+    return ScanState::kFallback;
+  }
+  bool found = true;
+  for (const auto& token : tokens) {
+    if (!found) {
+      return ScanState::kNotFound;
+    }
+    pos = skipWhitespace(valueBegin, end);
+    found = false;
+    if (*pos == '{') {
+      pos = skipWhitespace(pos + 1, end);
+      while (*pos != '}') {
+        const char* keyBegin = pos + 1;
+        pos = skipString(pos, end);
+        const char* keyEnd = pos - 1;
+        pos = skipWhitespace(pos, end);
+        pos = skipWhitespace(pos + 1, end); // skip ':'
+        const char* memberEnd = skipValue(pos, end);
+        if (std::memchr(keyBegin, '\\', keyEnd - keyBegin) != nullptr) {
+          // An escaped key can only be compared after unescaping, which
+          // the full parser does.
+          return ScanState::kFallback;
+        }
+        // Last duplicate key wins, like the full parser.
+        if (static_cast<size_t>(keyEnd - keyBegin) == token.key.size() &&
+            std::memcmp(keyBegin, token.key.data(), token.key.size()) == 0) {
+          valueBegin = pos;
+          valueEnd = memberEnd;
+          found = true;
+        }
+        pos = skipWhitespace(memberEnd, end);
+        if (*pos == ',') {
+          pos = skipWhitespace(pos + 1, end);
+        }
+      }
+    } else if (*pos == '[') {
+      if (token.index < 0) {
+        // Non-numeric key on an array finds nothing.
+        return ScanState::kNotFound;
+      }
+      pos = skipWhitespace(pos + 1, end);
+      int64_t elementIndex = 0;
+      while (*pos != ']') {
+        const char* elementEnd = skipValue(pos, end);
+        if (elementIndex == token.index) {
+          valueBegin = pos;
+          valueEnd = elementEnd;
+          found = true;
+          break;
+        }
+        ++elementIndex;
+        pos = skipWhitespace(elementEnd, end);
+        if (*pos == ',') {
+          pos = skipWhitespace(pos + 1, end);
+        }
+      }
+    }
+  }
+  if (!found) {
+    return ScanState::kNotFound;
+  }
+  value = folly::StringPiece(valueBegin, valueEnd);
+  return ScanState::kFound;
+}
+
+// Turns the text of a found scalar into the jsonExtractScalar result.
+// kFallback when the text needs parser normalization.
+ScanState scalarFromText(
+    folly::StringPiece text,
+    folly::Optional<std::string>& result) {
+  if (text.empty()) {
+    return ScanState::kFallback;
+  }
+  switch (text[0]) {
+    case '"':
+      if (std::memchr(text.data(), '\\', text.size()) != nullptr) {
+        // Needs unescaping.
+        return ScanState::kFallback;
+      }
+      result = text.subpiece(1, text.size() - 2).str();
+      return ScanState::kFound;
+    case '{':
+    case '[':
+    case 'n':
+      // Not a scalar (null is excluded like in the full path).
+      return ScanState::kNotFound;
+    case 't':
+    case 'f':
+      result = std::string(text.data(), text.size());
+      return ScanState::kFound;
+    default:
+      // Integers print the same as their text; doubles go through the
+      // parser whose formatting normalizes them.
+      if (std::memchr(text.data(), '.', text.size()) != nullptr ||
+          std::memchr(text.data(), 'e', text.size()) != nullptr ||
+          std::memchr(text.data(), 'E', text.size()) != nullptr ||
+          text.size() > 18) {
+        return ScanState::kFallback;
+      }
+      result = std::string(text.data(), text.size());
+      return ScanState::kFound;
+  }
+}
+
+} // namespace fastjson
+
 } // namespace
 
 folly::Optional<folly::dynamic> jsonExtract(
@@ -210,6 +549,30 @@ folly::Optional<folly::dynamic> jsonExtract(
 folly::Optional<std::string> jsonExtractScalar(
     folly::StringPiece json,
     folly::StringPiece path) {
+  // Fast path: for simple paths, scan the document text and touch only
+  // the bytes on the addressed path instead of materializing the whole
+  // document as folly::dynamic.
+  {
+    std::vector<fastjson::PathToken> tokens;
+    if (fastjson::parseSimplePath(path, tokens)) {
+      folly::StringPiece valueText;
+      auto state = fastjson::scanPath(json, tokens, valueText);
+      if (state == fastjson::ScanState::kNotFound) {
+        return folly::none;
+      }
+      if (state == fastjson::ScanState::kFound) {
+        folly::Optional<std::string> result;
+        state = fastjson::scalarFromText(valueText, result);
+        if (state == fastjson::ScanState::kFound) {
+          return result;
+        }
+        if (state == fastjson::ScanState::kNotFound) {
+          return folly::none;
+        }
+      }
+      // Fall through to the full parser.
+    }
+  }
   auto res = jsonExtract(json, path);
   // Not a scalar value
   if (isScalarType(res)) {
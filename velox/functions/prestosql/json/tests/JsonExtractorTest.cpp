@@ -501,3 +501,34 @@ TEST(JsonExtractorTest, jsonMultipleExtractsTest) {
   ASSERT_TRUE(extract2.hasValue());
   EXPECT_EQ(jsonExtract(json, "$.store.fruit").value(), extract2.value());
 }
+
+TEST(JsonExtractorTest, fastPathScalarTest) {
+  // Cases exercising the text-scanning fast path and its agreement
+  // with the full parser.
+  EXPECT_SCALAR_VALUE_EQ(
+      R"({"a": {"b": [1, 22, 333]}})"s, "$.a.b[2]"s, "333"s);
+  EXPECT_SCALAR_VALUE_EQ(R"({"a": " sp aces "})"s, "$.a"s, " sp aces "s);
+  EXPECT_SCALAR_VALUE_EQ(R"({"a": true, "b": false})"s, "$.b"s, "false"s);
+  EXPECT_SCALAR_VALUE_EQ(R"({"a": -17})"s, "$.a"s, "-17"s);
+  // Duplicate keys resolve to the last one, like the full parser.
+  EXPECT_SCALAR_VALUE_EQ(R"({"a": 1, "a": 2})"s, "$.a"s, "2"s);
+  // Nested values off the path with tricky content are skipped.
+  EXPECT_SCALAR_VALUE_EQ(
+      R"({"x": {"]": "}{", "q": [1, "]]"]}, "y": 7})"s, "$.y"s, "7"s);
+  // A numeric dotted token indexes arrays.
+  EXPECT_SCALAR_VALUE_EQ(R"([10, 20])"s, "$.1"s, "20"s);
+  // A bracket token looks up matching object keys.
+  EXPECT_SCALAR_VALUE_EQ(R"({"0": "zero"})"s, "$[0]"s, "zero"s);
+  // Null, missing keys, out of range indices and non-scalars.
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": null})"s, "$.a"s);
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": 1})"s, "$.b"s);
+  EXPECT_SCALAR_VALUE_NULL(R"([1, 2])"s, "$[5]"s);
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": {"b": 1}})"s, "$.a"s);
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": [1]})"s, "$.a"s);
+  // Malformed documents defer to the full parser and return null.
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": tru})"s, "$.a"s);
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": 1,})"s, "$.a"s);
+  EXPECT_SCALAR_VALUE_NULL(R"({"a": 1} trailing)"s, "$.a"s);
+  // Escaped strings take the full parser for unescaping.
+  EXPECT_SCALAR_VALUE_EQ(R"({"a": "x\ny"})"s, "$.a"s, "x\ny"s);
+}
@@ -1112,6 +1112,36 @@ TEST_F(DateTimeFunctionsTest, millisecondTimestampWithTimezone) {
           "millisecond(c0)", -980, "+05:30"));
 }
 
+TEST_F(DateTimeFunctionsTest, dateTruncNoTimeZone) {
+  const auto dateTrunc = [&](const std::string& unit,
+                             std::optional<Timestamp> timestamp) {
+    return evaluateOnce<Timestamp>(
+        fmt::format("date_trunc('{}', c0)", unit), timestamp);
+  };
+
+  // Without a session time zone sub-day units truncate with epoch
+  // arithmetic.
+  EXPECT_EQ(
+      Timestamp(998'474'640, 0),
+      dateTrunc("minute", Timestamp(998'474'645, 321'001'234)));
+  EXPECT_EQ(
+      Timestamp(998'474'400, 0),
+      dateTrunc("hour", Timestamp(998'474'645, 321'001'234)));
+  EXPECT_EQ(
+      Timestamp(998'438'400, 0),
+      dateTrunc("day", Timestamp(998'474'645, 321'001'234)));
+
+  // Pre-epoch timestamps floor toward the earlier boundary.
+  EXPECT_EQ(Timestamp(-120, 0), dateTrunc("minute", Timestamp(-61, 0)));
+  EXPECT_EQ(Timestamp(-86'400, 0), dateTrunc("day", Timestamp(-1, 0)));
+  EXPECT_EQ(Timestamp(-86'400, 0), dateTrunc("day", Timestamp(-86'400, 0)));
+
+  // Calendar units still go through the calendar.
+  EXPECT_EQ(
+      Timestamp(996'624'000, 0),
+      dateTrunc("month", Timestamp(998'474'645, 321'001'234)));
+}
+
 TEST_F(DateTimeFunctionsTest, dateTrunc) {
   const auto dateTrunc = [&](const std::string& unit,
                              std::optional<Timestamp> timestamp) {
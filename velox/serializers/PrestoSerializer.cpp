@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include "velox/serializers/PrestoSerializer.h"
+
+#include <folly/compression/Compression.h>
+
 #include "velox/common/base/Crc.h"
 #include "velox/common/memory/ByteStream.h"
 #include "velox/functions/prestosql/types/TimestampWithTimeZoneType.h"
@@ -47,11 +50,12 @@ int64_t computeChecksum(
     ByteStream* source,
     int codecMarker,
     int numRows,
-    int uncompressedSize) {
+    int uncompressedSize,
+    int payloadBytes) {
   auto offset = source->tellp();
   bits::Crc32 crc32;
 
-  auto remainingBytes = uncompressedSize;
+  auto remainingBytes = payloadBytes;
   while (remainingBytes > 0) {
     auto data = source->nextView(remainingBytes);
     crc32.process_bytes(data.data(), data.size());
@@ -78,6 +82,23 @@ bool isCompressedBitSet(int8_t codec) {
   return (codec & kCompressedBitMask) == kCompressedBitMask;
 }
 
+// Returns the page payload codec for 'name', nullptr for uncompressed.
+std::unique_ptr<folly::io::Codec> makePageCodec(const std::string& name) {
+  if (name.empty() || name == "none") {
+    return nullptr;
+  }
+  if (name == "lz4") {
+    return folly::io::getCodec(folly::io::CodecType::LZ4);
+  }
+  if (name == "zstd") {
+    return folly::io::getCodec(folly::io::CodecType::ZSTD);
+  }
+  if (name == "snappy") {
+    return folly::io::getCodec(folly::io::CodecType::SNAPPY);
+  }
+  VELOX_USER_FAIL("Unsupported exchange page compression codec: {}", name);
+}
+
 bool isEncryptedBit(int8_t codec) {
   return (codec & kEncryptedBitMask) == kEncryptedBitMask;
 }
@@ -1627,7 +1648,9 @@ class PrestoVectorSerializer : public VectorSerializer {
       std::shared_ptr<const RowType> rowType,
       int32_t numRows,
       StreamArena* streamArena,
-      bool useLosslessTimestamp) {
+      bool useLosslessTimestamp,
+      const std::string& compressionCodec)
+      : streamArena_(streamArena), codec_(makePageCodec(compressionCodec)) {
     auto types = rowType->children();
     auto numTypes = types.size();
     streams_.resize(numTypes);
@@ -1665,6 +1688,11 @@ class PrestoVectorSerializer : public VectorSerializer {
     flushInternal(vector->size(), true /*rle*/, out);
   }
 
+  bool flushRlePage(const RowVectorPtr& vector, OutputStream* out) override {
+    flushRle(vector, out);
+    return true;
+  }
+
   // Writes the contents to 'stream' in wire format
   void flushInternal(int32_t numRows, bool rle, OutputStream* out) {
     auto listener = dynamic_cast<PrestoOutputStreamListener*>(out->listener());
@@ -1678,6 +1706,11 @@ class PrestoVectorSerializer : public VectorSerializer {
       codec = getCodecMarker();
     }
 
+    if (codec_ != nullptr && !rle) {
+      flushCompressed(numRows, codec, listener, out);
+      return;
+    }
+
     int32_t offset = out->tellp();
 
     // Pause CRC computation
@@ -1735,6 +1768,76 @@ class PrestoVectorSerializer : public VectorSerializer {
   static const int32_t kSizeInBytesOffset{4 + 1};
   static const int32_t kHeaderSize{kSizeInBytesOffset + 4 + 4 + 8};
 
+  // Payloads below this size are not worth a compression round trip.
+  static constexpr int32_t kCompressionThreshold = 4096;
+
+  // Serializes the body to scratch memory, compresses it when that
+  // shrinks it, and writes the page with the compressed bit and the
+  // compressed size in sizeInBytes. Readers accept both forms since
+  // the marker travels with the page.
+  void flushCompressed(
+      int32_t numRows,
+      char codec,
+      PrestoOutputStreamListener* listener,
+      OutputStream* out) {
+    IOBufOutputStream bodyStream(
+        *streamArena_->mappedMemory(), nullptr, 64 * 1024);
+    writeInt32(&bodyStream, streams_.size());
+    for (auto& stream : streams_) {
+      stream->flush(&bodyStream);
+    }
+    auto bodyBuf = bodyStream.getIOBuf();
+    const int32_t uncompressedSize = bodyBuf->computeChainDataLength();
+    std::unique_ptr<folly::IOBuf> compressedBuf;
+    if (uncompressedSize >= kCompressionThreshold) {
+      compressedBuf = codec_->compress(bodyBuf.get());
+      if (compressedBuf->computeChainDataLength() >=
+          static_cast<size_t>(uncompressedSize)) {
+        compressedBuf.reset();
+      }
+    }
+    const bool compressed = compressedBuf != nullptr;
+    if (compressed) {
+      codec |= kCompressedBitMask;
+    }
+    const auto* payload = compressed ? compressedBuf.get() : bodyBuf.get();
+    const int32_t serializedSize =
+        compressed ? compressedBuf->computeChainDataLength() : uncompressedSize;
+
+    const int32_t offset = out->tellp();
+    if (listener) {
+      listener->pause();
+    }
+    writeInt32(out, numRows);
+    out->write(&codec, 1);
+    writeInt32(out, uncompressedSize);
+    writeInt32(out, serializedSize);
+    writeInt64(out, 0); // Checksum placeholder.
+    if (listener) {
+      listener->resume();
+    }
+    for (const auto& range : *payload) {
+      out->write(
+          reinterpret_cast<const char*>(range.data()), range.size());
+    }
+    if (listener) {
+      listener->pause();
+    }
+    int64_t crc = 0;
+    if (listener) {
+      crc = computeChecksum(listener, codec, numRows, uncompressedSize);
+    }
+    const int32_t endOffset = out->tellp();
+    out->seekp(offset + kSizeInBytesOffset + 8);
+    writeInt64(out, crc);
+    out->seekp(endOffset);
+  }
+
+  StreamArena* streamArena_{nullptr};
+
+  // Compresses page payloads when set.
+  std::unique_ptr<folly::io::Codec> codec_;
+
   int32_t numRows_{0};
   std::vector<std::unique_ptr<VectorStream>> streams_;
 };
@@ -1756,7 +1859,11 @@ std::unique_ptr<VectorSerializer> PrestoVectorSerde::createSerializer(
       ? static_cast<const PrestoOptions*>(options)->useLosslessTimestamp
       : false;
   return std::make_unique<PrestoVectorSerializer>(
-      type, numRows, streamArena, useLosslessTimestamp);
+      type,
+      numRows,
+      streamArena,
+      useLosslessTimestamp,
+      options != nullptr ? options->compressionCodec : "none");
 }
 
 void PrestoVectorSerde::serializeConstants(
@@ -1789,25 +1896,50 @@ void PrestoVectorSerde::deserialize(
 
   auto pageCodecMarker = source->read<int8_t>();
   auto uncompressedSize = source->read<int32_t>();
-  // skip size in bytes
-  source->skip(4);
+  auto sizeInBytes = source->read<int32_t>();
   auto checksum = source->read<int64_t>();
 
+  const bool compressed = isCompressedBitSet(pageCodecMarker);
+  const int32_t payloadBytes = compressed ? sizeInBytes : uncompressedSize;
+
   int64_t actualCheckSum = 0;
   if (isChecksumBitSet(pageCodecMarker)) {
-    actualCheckSum =
-        computeChecksum(source, pageCodecMarker, numRows, uncompressedSize);
+    actualCheckSum = computeChecksum(
+        source, pageCodecMarker, numRows, uncompressedSize, payloadBytes);
   }
 
   VELOX_CHECK_EQ(
       checksum, actualCheckSum, "Received corrupted serialized page.");
 
+  // Decompress the payload when the page is marked compressed. The
+  // codec comes from the options shared through the query config.
+  ByteStream decompressedStream;
+  std::string compressedScratch;
+  std::string decompressed;
+  ByteStream* body = source;
+  if (compressed) {
+    auto codec = makePageCodec(
+        options != nullptr ? options->compressionCodec : "none");
+    VELOX_USER_CHECK_NOT_NULL(
+        codec,
+        "Received a compressed page but no exchange compression codec "
+        "is configured.");
+    compressedScratch.resize(sizeInBytes);
+    source->readBytes(compressedScratch.data(), sizeInBytes);
+    decompressed = codec->uncompress(compressedScratch, uncompressedSize);
+    decompressedStream.resetInput({ByteRange{
+        reinterpret_cast<uint8_t*>(const_cast<char*>(decompressed.data())),
+        static_cast<int32_t>(decompressed.size()),
+        0}});
+    body = &decompressedStream;
+  }
+
   // skip number of columns
-  source->skip(4);
+  body->skip(4);
 
   auto children = &(*result)->children();
   auto childTypes = type->as<TypeKind::ROW>().children();
-  readColumns(source, pool, childTypes, children, useLosslessTimestamp);
+  readColumns(body, pool, childTypes, children, useLosslessTimestamp);
 }
 
 // static
@@ -15,6 +15,9 @@
  */
 
 #include "velox/substrait/SubstraitToVeloxPlan.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include "velox/substrait/TypeUtils.h"
 #include "velox/type/Type.h"
 #include "velox/vector/ComplexVector.h"
@@ -45,6 +48,7 @@ core::AggregationNode::Step toAggregationStep(
       VELOX_FAIL("Aggregate phase is not supported.");
   }
 }
+
 } // namespace
 namespace {
 template <TypeKind KIND>
@@ -654,4 +658,45 @@ const std::string& SubstraitVeloxPlanConverter::findFunction(
   return substraitParser_->findFunctionSpec(functionMap_, id);
 }
 
+// static
+std::string SubstraitVeloxPlanCache::fingerprint(
+    const ::substrait::Plan& substraitPlan) {
+  std::string data;
+  {
+    google::protobuf::io::StringOutputStream stream(&data);
+    google::protobuf::io::CodedOutputStream coded(&stream);
+    // Deterministic serialization makes equal messages produce equal
+    // bytes regardless of map field iteration order.
+    coded.SetSerializationDeterministic(true);
+    substraitPlan.SerializeToCodedStream(&coded);
+  }
+  return data;
+}
+
+SubstraitVeloxPlanCache::Entry SubstraitVeloxPlanCache::getOrConvert(
+    SubstraitVeloxPlanConverter& converter,
+    const ::substrait::Plan& substraitPlan) {
+  auto key = fingerprint(substraitPlan);
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+  }
+
+  Entry entry;
+  entry.plan = converter.toVeloxPlan(substraitPlan);
+  entry.splitInfos = converter.splitInfos();
+
+  std::lock_guard<std::mutex> l(mutex_);
+  if (cache_.size() >= maxEntries_) {
+    // More distinct plan shapes than the cap; drop everything instead
+    // of tracking recency for a cache expected to hold few shapes.
+    cache_.clear();
+  }
+  cache_.emplace(std::move(key), entry);
+  return entry;
+}
+
 } // namespace facebook::velox::substrait
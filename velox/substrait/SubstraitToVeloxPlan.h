@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "velox/connectors/hive/HiveConnector.h"
 #include "velox/core/PlanNode.h"
 #include "velox/substrait/SubstraitToVeloxExpr.h"
@@ -144,4 +146,37 @@ class SubstraitVeloxPlanConverter {
   memory::MemoryPool* pool_;
 };
 
+/// Process-wide cache of converted Substrait plans keyed by the
+/// deterministic serialization of the ::substrait::Plan message, so a
+/// gateway that submits the same plan repeatedly pays conversion once.
+/// The cached PlanNode tree is immutable and safe to share across
+/// Tasks; the split info map is returned alongside it since it is part
+/// of the conversion result.
+class SubstraitVeloxPlanCache {
+ public:
+  struct Entry {
+    core::PlanNodePtr plan;
+    std::unordered_map<
+        core::PlanNodeId,
+        std::shared_ptr<SubstraitVeloxPlanConverter::SplitInfo>>
+        splitInfos;
+  };
+
+  explicit SubstraitVeloxPlanCache(uint32_t maxEntries = 1'000)
+      : maxEntries_(maxEntries) {}
+
+  /// Returns the cached conversion of 'substraitPlan', converting it
+  /// with 'converter' and caching the result on a miss.
+  Entry getOrConvert(
+      SubstraitVeloxPlanConverter& converter,
+      const ::substrait::Plan& substraitPlan);
+
+ private:
+  static std::string fingerprint(const ::substrait::Plan& substraitPlan);
+
+  const uint32_t maxEntries_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> cache_;
+};
+
 } // namespace facebook::velox::substrait
@@ -287,3 +287,35 @@ TEST_F(Substrait2VeloxPlanConversionTest, q6) {
       .splits(makeSplits(planConverter, planNode))
       .assertResults(expectedResult);
 }
+
+TEST_F(Substrait2VeloxPlanConversionTest, planCache) {
+  std::string planPath =
+      getDataFilePath("velox/substrait/tests", "data/q6_first_stage.json");
+
+  ::substrait::Plan substraitPlan;
+  JsonToProtoConverter::readFromFile(planPath, substraitPlan);
+
+  facebook::velox::substrait::SubstraitVeloxPlanCache cache;
+
+  facebook::velox::substrait::SubstraitVeloxPlanConverter converter1(
+      pool_.get());
+  auto entry1 = cache.getOrConvert(converter1, substraitPlan);
+
+  // A second submission of the same plan hits the cache: the identical
+  // immutable PlanNode tree is returned, no conversion runs.
+  facebook::velox::substrait::SubstraitVeloxPlanConverter converter2(
+      pool_.get());
+  auto entry2 = cache.getOrConvert(converter2, substraitPlan);
+
+  EXPECT_EQ(entry1.plan.get(), entry2.plan.get());
+  EXPECT_EQ(entry1.splitInfos.size(), entry2.splitInfos.size());
+
+  // A plan serializing to different bytes misses.
+  ::substrait::Plan otherPlan = substraitPlan;
+  otherPlan.add_expected_type_urls("test");
+  facebook::velox::substrait::SubstraitVeloxPlanConverter converter3(
+      pool_.get());
+  EXPECT_NE(
+      entry1.plan.get(), cache.getOrConvert(converter3, otherPlan).plan.get());
+}
+
@@ -62,6 +62,9 @@ std::string Filter::toString() const {
     case FilterKind::kNegatedBigintValuesUsingBitmask:
       strKind = "NegatedBigintValuesUsingBitmask";
       break;
+    case FilterKind::kBigintBloomFilter:
+      strKind = "BigintBloomFilter";
+      break;
     case FilterKind::kDoubleRange:
       strKind = "DoubleRange";
       break;
@@ -25,6 +25,7 @@
 #include <folly/Range.h>
 #include <folly/container/F14Set.h>
 
+#include "velox/common/base/BloomFilter.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
 #include "velox/type/StringView.h"
@@ -44,6 +45,7 @@ enum class FilterKind {
   kNegatedBigintRange,
   kNegatedBigintValuesUsingHashTable,
   kNegatedBigintValuesUsingBitmask,
+  kBigintBloomFilter,
   kDoubleRange,
   kFloatRange,
   kBytesRange,
@@ -836,6 +838,70 @@ class BigintValuesUsingBitmask final : public Filter {
   const int64_t max_;
 };
 
+/// Approximate IN-list filter for integral data types backed by a Bloom
+/// filter. Used for dynamic filters pushed down from a hash join build
+/// side when the key domain is too large for an exact value set. May
+/// pass values that are not in the set (false positives) but never
+/// rejects values that are, so consumers must re-verify matches; the
+/// join cannot be elided based on this filter.
+class BigintBloomFilter final : public Filter {
+ public:
+  /// @param capacity Number of distinct values expected, used to size
+  /// the Bloom filter for a low false positive rate.
+  /// @param nullAllowed Null values are passing the filter if true.
+  BigintBloomFilter(int32_t capacity, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter) {
+    bloom_.reset(capacity);
+  }
+
+  BigintBloomFilter(const BigintBloomFilter& other, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter),
+        bloom_(other.bloom_) {}
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> nullAllowed = std::nullopt) const final {
+    if (nullAllowed) {
+      return std::make_unique<BigintBloomFilter>(*this, nullAllowed.value());
+    } else {
+      return std::make_unique<BigintBloomFilter>(*this);
+    }
+  }
+
+  void insert(int64_t value) {
+    bloom_.insert(value);
+  }
+
+  bool testInt64(int64_t value) const final {
+    return bloom_.mayContain(value);
+  }
+
+  bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final {
+    if (hasNull && nullAllowed_) {
+      return true;
+    }
+    if (min == max) {
+      return testInt64(min);
+    }
+    // A Bloom filter cannot disprove a range of more than one value.
+    return true;
+  }
+
+  std::unique_ptr<Filter> mergeWith(const Filter* other) const final {
+    switch (other->kind()) {
+      case FilterKind::kAlwaysTrue:
+      case FilterKind::kIsNotNull:
+        return this->clone(nullAllowed_ && other->testNull());
+      default:
+        // 'this' is advisory only; keep the exact filter rather than
+        // approximating the conjunction.
+        return other->clone();
+    }
+  }
+
+ private:
+  BloomFilter<true> bloom_;
+};
+
 // NOT IN-list filter for integral data types. Implemented as a hash table. Good
 // for large number of rejected values that do not fit within a small range.
 class NegatedBigintValuesUsingHashTable final : public Filter {
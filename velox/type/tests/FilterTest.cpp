@@ -442,6 +442,42 @@ TEST(FilterTest, bigintValuesUsingBitmask) {
   EXPECT_FALSE(filter->testInt64Range(1234, 2000, false));
 }
 
+TEST(FilterTest, bigintBloomFilter) {
+  BigintBloomFilter filter(1000, false);
+  for (int64_t i = 0; i < 1000; ++i) {
+    filter.insert(i * 3);
+  }
+
+  // No false negatives.
+  for (int64_t i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(filter.testInt64(i * 3));
+  }
+  EXPECT_FALSE(filter.testNull());
+
+  // Mostly rejects values not in the set; the filter is approximate, so
+  // only check the aggregate false positive rate.
+  int32_t falsePositives = 0;
+  for (int64_t i = 0; i < 1000; ++i) {
+    if (filter.testInt64(i * 3 + 1)) {
+      ++falsePositives;
+    }
+  }
+  EXPECT_LT(falsePositives, 100);
+
+  // Single-value ranges are testable; wider ranges pass.
+  EXPECT_TRUE(filter.testInt64Range(3, 3, false));
+  EXPECT_TRUE(filter.testInt64Range(0, 1000000, false));
+
+  // Merging keeps the exact filter.
+  auto range = greaterThanOrEqual(10);
+  auto merged = filter.mergeWith(range.get());
+  EXPECT_EQ(FilterKind::kBigintRange, merged->kind());
+
+  auto clone = filter.clone();
+  EXPECT_TRUE(clone->testInt64(3));
+  EXPECT_EQ(FilterKind::kBigintBloomFilter, clone->kind());
+}
+
 TEST(FilterTest, negatedBigintValuesUsingBitmask) {
   auto filter = createNegatedBigintValues({1, 6, 1000, 8, 9, 100, 10}, false);
   auto castedFilter =
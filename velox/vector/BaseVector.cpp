@@ -528,6 +528,16 @@ std::string BaseVector::toString(
   return out.str();
 }
 
+uint64_t BaseVector::deduplicatedRetainedSize() const {
+  folly::F14FastSet<const Buffer*> buffers;
+  collectRetainedBuffers(buffers);
+  uint64_t size = 0;
+  for (const auto* buffer : buffers) {
+    size += buffer->capacity();
+  }
+  return size;
+}
+
 void BaseVector::ensureWritable(const SelectivityVector& rows) {
   auto newSize = std::max<vector_size_t>(rows.size(), length_);
   if (nulls_ && !(nulls_->unique() && nulls_->isMutable())) {
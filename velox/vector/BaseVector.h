@@ -25,6 +25,7 @@
 #include <folly/Format.h>
 #include <folly/Range.h>
 #include <folly/container/F14Map.h>
+#include <folly/container/F14Set.h>
 
 #include "velox/buffer/Buffer.h"
 #include "velox/common/base/BitUtil.h"
@@ -633,6 +634,22 @@ class BaseVector {
     return nulls_ ? nulls_->capacity() : 0;
   }
 
+  /// Collects the distinct buffers kept alive through 'this' into
+  /// 'buffers'. A buffer shared across children, wrapper levels or
+  /// sibling vectors is inserted once, so summing the capacities of the
+  /// collected set gives an accurate retained size where retainedSize()
+  /// double-counts shared memory.
+  virtual void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const {
+    if (nulls_) {
+      buffers.insert(nulls_.get());
+    }
+  }
+
+  /// Returns the total capacity of the distinct buffers reachable from
+  /// 'this'. See collectRetainedBuffers().
+  uint64_t deduplicatedRetainedSize() const;
+
   /// Returns an estimate of the 'retainedSize' of a flat representation of the
   /// data stored in this vector. Returns zero if this is a lazy vector that
   /// hasn't been loaded yet.
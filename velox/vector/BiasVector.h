@@ -142,6 +142,12 @@ class BiasVector : public SimpleVector<T> {
     return BaseVector::retainedSize() + values_->capacity();
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    buffers.insert(values_.get());
+  }
+
   /**
    * Returns a shared_ptr to the underlying arrow array holding the values for
    * this vector. This is used during execution to process over the subset of
@@ -146,6 +146,16 @@ class RowVector : public BaseVector {
     return size;
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    for (auto& child : children_) {
+      if (child) {
+        child->collectRetainedBuffers(buffers);
+      }
+    }
+  }
+
   uint64_t estimateFlatSize() const override;
 
   using BaseVector::toString;
@@ -424,6 +434,14 @@ class ArrayVector : public ArrayVectorBase {
         sizes_->capacity() + elements_->retainedSize();
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    buffers.insert(offsets_.get());
+    buffers.insert(sizes_.get());
+    elements_->collectRetainedBuffers(buffers);
+  }
+
   uint64_t estimateFlatSize() const override;
 
   using BaseVector::toString;
@@ -567,6 +585,15 @@ class MapVector : public ArrayVectorBase {
         sizes_->capacity() + keys_->retainedSize() + values_->retainedSize();
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    buffers.insert(offsets_.get());
+    buffers.insert(sizes_.get());
+    keys_->collectRetainedBuffers(buffers);
+    values_->collectRetainedBuffers(buffers);
+  }
+
   uint64_t estimateFlatSize() const override;
 
   using BaseVector::toString;
@@ -214,6 +214,16 @@ class ConstantVector final : public SimpleVector<T> {
     return sizeof(T);
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    if (valueVector_) {
+      valueVector_->collectRetainedBuffers(buffers);
+    } else if (stringBuffer_) {
+      buffers.insert(stringBuffer_.get());
+    }
+  }
+
   BaseVector* loadedVector() override {
     if (!valueVector_) {
       return this;
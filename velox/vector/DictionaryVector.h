@@ -130,6 +130,13 @@ class DictionaryVector : public SimpleVector<T> {
         indices_->capacity();
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    buffers.insert(indices_.get());
+    dictionaryValues_->collectRetainedBuffers(buffers);
+  }
+
   bool isConstant(const SelectivityVector& rows) const override {
     VELOX_CHECK(rows.hasSelections(), "No selected rows in isConstant()");
     auto firstIdx = getDictionaryIndex(rows.begin());
@@ -207,8 +207,17 @@ Buffer* FlatVector<StringView>::getBufferWithSpace(vector_size_t size) {
     return buffer;
   }
 
-  // Allocate a new buffer.
-  int32_t newSize = std::max(kInitialStringSize, size);
+  // Allocate a new buffer. Grow geometrically: allocating at least as
+  // much as the existing buffers hold, capped at kMaxStringSizeForReuse
+  // per step, cuts the number of allocations for string-heavy batches
+  // from linear in the written bytes to logarithmic.
+  int64_t existingCapacity = 0;
+  for (const auto& stringBuffer : stringBuffers_) {
+    existingCapacity += stringBuffer->capacity();
+  }
+  const int32_t newSize = std::max<int64_t>(
+      std::max<int32_t>(kInitialStringSize, size),
+      std::min<int64_t>(existingCapacity, kMaxStringSizeForReuse));
   BufferPtr newBuffer = AlignedBuffer::allocate<char>(newSize, pool());
   newBuffer->setSize(0);
   addStringBuffer(newBuffer);
@@ -250,6 +259,53 @@ void FlatVector<StringView>::prepareForReuse() {
   SimpleVector<StringView>::invalidateIsAscii();
 }
 
+template <>
+void FlatVector<StringView>::compactStringBuffers() {
+  if (stringBuffers_.size() <= 1) {
+    return;
+  }
+  // Rewriting the views requires exclusive ownership of the values.
+  if (!(values_ && values_->unique() && values_->isMutable())) {
+    return;
+  }
+
+  // Bytes referenced by this vector's rows vs. bytes held alive in the
+  // current buffers. Rows sharing one string count it once per row, so
+  // skip when compaction would grow memory instead of shrinking it.
+  int64_t referencedBytes = 0;
+  for (vector_size_t i = 0; i < BaseVector::length_; ++i) {
+    if (!isNullAt(i) && !rawValues_[i].isInline()) {
+      referencedBytes += rawValues_[i].size();
+    }
+  }
+  if (referencedBytes == 0) {
+    clearStringBuffers();
+    return;
+  }
+  int64_t heldBytes = 0;
+  for (const auto& buffer : stringBuffers_) {
+    heldBytes += buffer->size();
+  }
+  if (referencedBytes > heldBytes) {
+    return;
+  }
+
+  auto newBuffer = AlignedBuffer::allocate<char>(referencedBytes, pool_);
+  newBuffer->setSize(referencedBytes);
+  auto* rawNewBuffer = newBuffer->asMutable<char>();
+  auto* mutableValues = values_->asMutable<StringView>();
+  int64_t offset = 0;
+  for (vector_size_t i = 0; i < BaseVector::length_; ++i) {
+    if (!isNullAt(i) && !mutableValues[i].isInline()) {
+      const auto size = mutableValues[i].size();
+      memcpy(rawNewBuffer + offset, mutableValues[i].data(), size);
+      mutableValues[i] = StringView(rawNewBuffer + offset, size);
+      offset += size;
+    }
+  }
+  setStringBuffers({std::move(newBuffer)});
+}
+
 template <>
 void FlatVector<StringView>::set(vector_size_t idx, StringView value) {
   VELOX_DCHECK(idx < BaseVector::length_);
@@ -373,6 +373,17 @@ class FlatVector final : public SimpleVector<T> {
     return size;
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    if (values_) {
+      buffers.insert(values_.get());
+    }
+    for (auto& buffer : stringBuffers_) {
+      buffers.insert(buffer.get());
+    }
+  }
+
   /**
    * Used for vectors of type VARCHAR and VARBINARY to hold data referenced by
    * StringView's. It is safe to share these among multiple vectors. These
@@ -437,6 +448,15 @@ class FlatVector final : public SimpleVector<T> {
   /// mutable. Resizes the buffer to zero to allow for reuse instead of append.
   void prepareForReuse() override;
 
+  /// Rewrites the out-of-line strings referenced by this vector's rows
+  /// contiguously into a single new buffer and drops the old string
+  /// buffers, so downstream passes touch one buffer instead of many.
+  /// No-op unless the values buffer is singly-referenced and mutable and
+  /// the referenced bytes do not exceed the bytes currently held in
+  /// string buffers (rows sharing one string would otherwise grow
+  /// memory). Only defined for StringView vectors.
+  void compactStringBuffers();
+
  private:
   void copyValuesAndNulls(
       const BaseVector* source,
@@ -526,6 +546,9 @@ Buffer* FlatVector<StringView>::getBufferWithSpace(vector_size_t size);
 template <>
 void FlatVector<StringView>::prepareForReuse();
 
+template <>
+void FlatVector<StringView>::compactStringBuffers();
+
 template <typename T>
 using FlatVectorPtr = std::shared_ptr<FlatVector<T>>;
 
@@ -251,6 +251,15 @@ class LazyVector : public BaseVector {
                       : BaseVector::retainedSize();
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    if (isLoaded()) {
+      loadedVector()->collectRetainedBuffers(buffers);
+    } else {
+      BaseVector::collectRetainedBuffers(buffers);
+    }
+  }
+
   /// Returns zero if vector has not been loaded yet.
   uint64_t estimateFlatSize() const override {
     return isLoaded() ? loadedVector()->estimateFlatSize() : 0;
@@ -135,6 +135,13 @@ class SequenceVector : public SimpleVector<T> {
     return sequenceValues_->retainedSize() + sequenceLengths_->capacity();
   }
 
+  void collectRetainedBuffers(
+      folly::F14FastSet<const Buffer*>& buffers) const override {
+    BaseVector::collectRetainedBuffers(buffers);
+    buffers.insert(sequenceLengths_.get());
+    sequenceValues_->collectRetainedBuffers(buffers);
+  }
+
   bool isConstant(const SelectivityVector& rows) const override {
     return offsetOfIndex(rows.begin()) == offsetOfIndex(rows.end() - 1);
   }
@@ -54,6 +54,12 @@ void VectorStreamGroup::flush(OutputStream* out) {
   serializer_->flush(out);
 }
 
+bool VectorStreamGroup::flushRlePage(
+    const RowVectorPtr& vector,
+    OutputStream* out) {
+  return serializer_->flushRlePage(vector, out);
+}
+
 // static
 void VectorStreamGroup::estimateSerializedSize(
     VectorPtr vector,
@@ -41,6 +41,17 @@ class VectorSerializer {
 
   // Writes the contents to 'stream' in wire format
   virtual void flush(OutputStream* stream) = 0;
+
+  /// Writes 'vector', whose columns are all constant, to 'stream' as a
+  /// run-length encoded page: one value per column plus the row count,
+  /// independent of vector size. Returns false if the serde has no RLE
+  /// page representation, in which case the caller appends and flushes
+  /// normally. Must be called on an empty serializer.
+  virtual bool flushRlePage(
+      const RowVectorPtr& /*vector*/,
+      OutputStream* /*stream*/) {
+    return false;
+  }
 };
 
 class VectorSerde {
@@ -50,6 +61,14 @@ class VectorSerde {
   // custom options by each of its extended classes.
   struct Options {
     virtual ~Options() {}
+
+    /// Codec for compressing serialized page payloads where the serde
+    /// supports it: "none", "lz4", "zstd", "snappy". Pages mark
+    /// themselves compressed, so readers accept both, but a reader
+    /// needs the codec configured to open compressed pages. Producers
+    /// and consumers of an exchange share this through the query
+    /// config.
+    std::string compressionCodec{"none"};
   };
 
   virtual void estimateSerializedSize(
@@ -97,6 +116,20 @@ class VectorStreamGroup : public StreamArena {
   // Writes the contents to 'stream' in wire format.
   void flush(OutputStream* stream);
 
+  /// Writes an all-constant 'vector' as an RLE page when the serde
+  /// supports it: one value per column plus the row count. Returns
+  /// false if unsupported, leaving the group unchanged.
+  bool flushRlePage(const RowVectorPtr& vector, OutputStream* stream);
+
+  // Drops the serialized state and retains the arena slabs for the
+  // streams of the next createStreamTree, so a group flushed once per
+  // batch reuses its memory instead of reallocating.
+  void clear() override {
+    // The serializer holds ranges into the arena, drop it first.
+    serializer_.reset();
+    StreamArena::clear();
+  }
+
   // Reads data in wire format. Returns the RowVector in 'result'.
   static void read(
       ByteStream* source,
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+using namespace facebook::velox;
+
+class CompactStringBuffersTest : public testing::Test,
+                                 public test::VectorTestBase {
+ protected:
+  // Makes a flat string vector whose rows reference one small string
+  // buffer each, simulating fragmentation after joins and filters.
+  FlatVectorPtr<StringView> makeFragmentedVector(vector_size_t size) {
+    auto vector = std::dynamic_pointer_cast<FlatVector<StringView>>(
+        BaseVector::create(VARCHAR(), size, pool()));
+    for (vector_size_t i = 0; i < size; ++i) {
+      const auto value = fmt::format("non-inline string number {}", i);
+      auto buffer = AlignedBuffer::allocate<char>(value.size(), pool());
+      memcpy(buffer->asMutable<char>(), value.data(), value.size());
+      vector->addStringBuffer(buffer);
+      vector->setNoCopy(i, StringView(buffer->as<char>(), value.size()));
+    }
+    return vector;
+  }
+};
+
+TEST_F(CompactStringBuffersTest, basic) {
+  auto vector = makeFragmentedVector(100);
+  auto expected = BaseVector::copy(*vector);
+  ASSERT_EQ(100, vector->stringBuffers().size());
+
+  vector->compactStringBuffers();
+
+  ASSERT_EQ(1, vector->stringBuffers().size());
+  test::assertEqualVectors(expected, vector);
+}
+
+TEST_F(CompactStringBuffersTest, sharedValuesSkipped) {
+  auto vector = makeFragmentedVector(10);
+  // A second reference to the values buffer must prevent rewriting the
+  // views in place.
+  auto values = vector->values();
+  vector->compactStringBuffers();
+  ASSERT_EQ(10, vector->stringBuffers().size());
+}
+
+TEST_F(CompactStringBuffersTest, sharedStringsNotGrown) {
+  // All rows reference the same out-of-line string, so compaction would
+  // copy it once per row and grow memory; it must back off.
+  const std::string value(50, 'x');
+  auto buffer = AlignedBuffer::allocate<char>(value.size(), pool());
+  memcpy(buffer->asMutable<char>(), value.data(), value.size());
+  auto extra = AlignedBuffer::allocate<char>(10, pool());
+
+  auto vector = std::dynamic_pointer_cast<FlatVector<StringView>>(
+      BaseVector::create(VARCHAR(), 100, pool()));
+  vector->addStringBuffer(buffer);
+  vector->addStringBuffer(extra);
+  for (vector_size_t i = 0; i < 100; ++i) {
+    vector->setNoCopy(i, StringView(buffer->as<char>(), value.size()));
+  }
+
+  vector->compactStringBuffers();
+  ASSERT_EQ(2, vector->stringBuffers().size());
+}
+
+TEST_F(CompactStringBuffersTest, allInline) {
+  auto vector = std::dynamic_pointer_cast<FlatVector<StringView>>(
+      BaseVector::create(VARCHAR(), 10, pool()));
+  auto buffer = AlignedBuffer::allocate<char>(10, pool());
+  auto extra = AlignedBuffer::allocate<char>(10, pool());
+  vector->addStringBuffer(buffer);
+  vector->addStringBuffer(extra);
+  for (vector_size_t i = 0; i < 10; ++i) {
+    vector->setNoCopy(i, StringView("inline"));
+  }
+
+  // No out-of-line strings are referenced; the buffers are dropped.
+  vector->compactStringBuffers();
+  ASSERT_TRUE(vector->stringBuffers().empty());
+}
@@ -124,6 +124,61 @@ TEST(SelectivityVectorTest, basicOperation) {
   ASSERT_NO_FATAL_FAILURE(assertState(expected, vector)) << "setAll() called";
 }
 
+TEST(SelectivityVectorTest, applyToSelectedRanges) {
+  auto collectRanges = [](const SelectivityVector& rows) {
+    std::vector<std::pair<vector_size_t, vector_size_t>> ranges;
+    rows.applyToSelectedRanges(
+        [&](vector_size_t begin, vector_size_t end) {
+          ranges.emplace_back(begin, end);
+        });
+    return ranges;
+  };
+  using Ranges = std::vector<std::pair<vector_size_t, vector_size_t>>;
+
+  // All selected: one range.
+  SelectivityVector allRows(1'000);
+  ASSERT_EQ(Ranges({{0, 1'000}}), collectRanges(allRows));
+
+  // Contiguous prefix.
+  SelectivityVector prefix(1'000);
+  prefix.setValidRange(300, 1'000, false);
+  prefix.updateBounds();
+  ASSERT_EQ(Ranges({{0, 300}}), collectRanges(prefix));
+
+  // Runs crossing word boundaries and single-row runs.
+  SelectivityVector rows(1'000, false);
+  rows.setValidRange(10, 20, true);
+  rows.setValidRange(60, 70, true);
+  rows.setValid(128, true);
+  rows.setValidRange(500, 700, true);
+  rows.updateBounds();
+  ASSERT_EQ(
+      Ranges({{10, 20}, {60, 70}, {128, 129}, {500, 700}}),
+      collectRanges(rows));
+
+  // Empty selection.
+  SelectivityVector empty(1'000, false);
+  empty.updateBounds();
+  ASSERT_EQ(Ranges(), collectRanges(empty));
+
+  // Ranges and per-row iteration agree on a pseudo-random selection.
+  SelectivityVector random(1'000, false);
+  for (auto i = 0; i < 1'000; ++i) {
+    random.setValid(i, (i * 31) % 7 < 3);
+  }
+  random.updateBounds();
+  std::vector<vector_size_t> fromRanges;
+  random.applyToSelectedRanges([&](vector_size_t begin, vector_size_t end) {
+    for (auto row = begin; row < end; ++row) {
+      fromRanges.push_back(row);
+    }
+  });
+  std::vector<vector_size_t> fromRows;
+  random.applyToSelected(
+      [&](vector_size_t row) { fromRows.push_back(row); });
+  ASSERT_EQ(fromRows, fromRanges);
+}
+
 TEST(SelectivityVectorTest, updateBounds) {
   const size_t vectorSize = 10;
   SelectivityVector vector(vectorSize);
@@ -529,3 +529,29 @@ TEST_F(VectorEstimateFlatSizeTest, structs) {
   EXPECT_EQ(2837, row->estimateFlatSize());
   EXPECT_EQ(3295, flatten(row)->estimateFlatSize());
 }
+
+TEST_F(VectorEstimateFlatSizeTest, deduplicatedRetainedSize) {
+  auto flat = makeFlatVector<int64_t>(1'000, int64At);
+  // No sharing: deduplicated size matches retainedSize.
+  EXPECT_EQ(flat->retainedSize(), flat->deduplicatedRetainedSize());
+
+  // Two dictionaries over the same base and the same indices buffer.
+  auto indices = makeIndices(1'000, [](auto row) { return row; });
+  auto dict1 = BaseVector::wrapInDictionary(nullptr, indices, 1'000, flat);
+  auto dict2 = BaseVector::wrapInDictionary(nullptr, indices, 1'000, flat);
+  auto row = makeRowVector({dict1, dict2});
+
+  // retainedSize() charges the shared base and indices once per child.
+  EXPECT_EQ(
+      row->retainedSize(),
+      2 * (indices->capacity() + flat->retainedSize()));
+  // The deduplicated walk counts each distinct buffer once.
+  EXPECT_EQ(
+      row->deduplicatedRetainedSize(),
+      indices->capacity() + flat->deduplicatedRetainedSize());
+
+  // The same child appearing twice is also counted once.
+  auto duplicated = makeRowVector({flat, flat});
+  EXPECT_EQ(
+      duplicated->deduplicatedRetainedSize(), flat->deduplicatedRetainedSize());
+}
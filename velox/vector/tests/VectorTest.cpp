@@ -962,6 +962,25 @@ TEST_F(VectorTest, createStr) {
   testFlat<TypeKind::VARBINARY>(VARBINARY(), vectorSize_);
 }
 
+TEST_F(VectorTest, stringBufferGeometricGrowth) {
+  // Writing ~1MB of out-of-line strings allocates a logarithmic number
+  // of string buffers, not one 32KB buffer per 32KB written.
+  auto vector = BaseVector::create(VARCHAR(), 1'000, pool_.get());
+  auto* flat = vector->asFlatVector<StringView>();
+  const std::string value(1'000, 'x');
+  for (auto i = 0; i < flat->size(); ++i) {
+    flat->set(i, StringView(value));
+  }
+
+  const auto& buffers = flat->stringBuffers();
+  EXPECT_LE(buffers.size(), 10);
+  int64_t capacity = 0;
+  for (const auto& buffer : buffers) {
+    capacity += buffer->capacity();
+  }
+  EXPECT_GE(capacity, flat->size() * value.size());
+}
+
 TEST_F(VectorTest, createOther) {
   testFlat<TypeKind::BOOLEAN>(BOOLEAN(), vectorSize_);
   testFlat<TypeKind::TIMESTAMP>(TIMESTAMP(), vectorSize_);